@@ -0,0 +1,248 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef ACQUISITION_H
+#define ACQUISITION_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "EventQueue.h"
+#include "Nunchuk.h"
+
+#if defined(ESP32)
+#define NUNCHUK_ACQUISITION_FREERTOS 1
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif !defined(ARDUINO)
+#define NUNCHUK_ACQUISITION_THREAD 1
+#include <atomic>
+#include <chrono>
+#include <thread>
+#endif
+
+namespace communication
+{
+
+/**
+ * @brief Datensatz mit Zeitstempel, wie er von der Erfassung weitergegeben wird
+ */
+struct Sample
+{
+	Frame frame; // empfangener Datensatz
+	unsigned long time; // Zeitpunkt des Empfangs in µs (Clock::current())
+	uint16_t sequence; // fortlaufende Nummer, Lücken zeigen verworfene Datensätze an
+};
+
+/**
+ * @brief Klassen-Template einer Erfassung im Hintergrund. Ein eigener Task (FreeRTOS auf
+ * ESP32) bzw. Thread (std::thread auf Host-Builds) führt die Bustransaktionen mit fester
+ * Periode durch und legt jeden empfangenen Datensatz in einer sperrfreien Warteschlange ab,
+ * aus der genau ein Verbraucher liest.
+ * Auf Plattformen ohne Tasks (z. B. AVR) steht nur step() zur Verfügung, das dann z. B. aus
+ * loop() aufgerufen wird.
+ *
+ * Solange die Erfassung läuft, darf das Gerät nur von ihr verwendet werden. Die Periode gibt
+ * den Takt vor, die Zykluszeit des Geräts sollte daher nicht größer sein (z. B. NoCycleTimer).
+ *
+ * @tparam Device Konfiguration von NunchukT
+ * @tparam Length Anzahl der Datensätze, die gleichzeitig in der Warteschlange liegen können
+ */
+template<
+	class Device,
+	uint8_t Length = 16
+>
+class Acquisition
+{
+	public: // public static Member
+
+		// Größe des Stacks des Tasks in Byte (FreeRTOS)
+		static constexpr const uint32_t STACK_SIZE{3072};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der Acquisition Klasse
+		 *
+		 * @param device Referenz auf das bereits initialisierte Gerät
+		 * @param period Periode der Bustransaktionen in ms
+		 */
+		Acquisition(Device &device, const unsigned long period)
+		: m_device{device},
+		  m_period{(period == 0) ? 1 : period},
+		  m_queue{},
+		  m_sequence{0},
+		  m_running{false}
+		{
+
+		}
+
+		~Acquisition()
+		{
+			stop();
+		}
+
+		/**
+		 * @brief Startet den Task bzw. Thread der Erfassung
+		 *
+		 * @param core Kern, auf dem der Task läuft (nur FreeRTOS)
+		 * @param priority Priorität des Tasks (nur FreeRTOS)
+		 * @return true Erfassung läuft
+		 * @return false Erfassung lief bereits oder Plattform ohne Tasks
+		 */
+		const bool start(const uint8_t core = 0, const uint8_t priority = 1)
+		{
+			if (running())
+			{
+				return false;
+			}
+
+#if defined(NUNCHUK_ACQUISITION_FREERTOS)
+			m_running = true;
+			m_finished = false;
+			if (xTaskCreatePinnedToCore(&Acquisition::task, "nunchuk", STACK_SIZE, this,
+				priority, &m_task, core) != pdPASS)
+			{
+				m_running = false;
+				return false;
+			}
+			return true;
+#elif defined(NUNCHUK_ACQUISITION_THREAD)
+			(void)core;
+			(void)priority;
+			m_running = true;
+			m_thread = std::thread(&Acquisition::run, this);
+			return true;
+#else
+			(void)core;
+			(void)priority;
+			return false;
+#endif
+		}
+
+		/**
+		 * @brief Beendet die Erfassung und wartet auf das Ende des Tasks bzw. Threads
+		 */
+		void stop()
+		{
+			if (!running())
+			{
+				return;
+			}
+
+			m_running = false;
+#if defined(NUNCHUK_ACQUISITION_FREERTOS)
+			while (!m_finished)
+			{
+				vTaskDelay(1);
+			}
+#elif defined(NUNCHUK_ACQUISITION_THREAD)
+			m_thread.join();
+#endif
+		}
+
+		/**
+		 * @brief Gibt zurück, ob die Erfassung läuft
+		 */
+		const bool running() const
+		{
+			return m_running;
+		}
+
+		/**
+		 * @brief Führt einen Erfassungszyklus aus: Gerät lesen und jeden empfangenen Datensatz,
+		 * auch einen unveränderten, in die Warteschlange legen
+		 *
+		 * @return State Rückgabewert von read()
+		 */
+		State step()
+		{
+			const State state = m_device.read();
+
+			if (state == State::CONNECTED)
+			{
+				m_queue.push(Sample{m_device.snapshot(), Clock::current(), m_sequence});
+				// auch verworfene Datensätze erhalten eine Nummer
+				m_sequence++;
+			}
+			return state;
+		}
+
+		/**
+		 * @brief Entnimmt den ältesten Datensatz (nur ein Verbraucher)
+		 *
+		 * @param sample Referenz auf das Ziel
+		 * @return true Datensatz entnommen
+		 * @return false keine Datensätze vorhanden
+		 */
+		const bool pop(Sample &sample)
+		{
+			return m_queue.pop(sample);
+		}
+
+		/**
+		 * @brief Gibt die Warteschlange zurück, z. B. um Füllstand und Überläufe abzufragen
+		 */
+		const EventQueue<Sample> &queue() const
+		{
+			return m_queue;
+		}
+
+	private: // private Methoden
+#if defined(NUNCHUK_ACQUISITION_FREERTOS)
+		/**
+		 * @brief Einstiegspunkt des FreeRTOS-Tasks
+		 */
+		static void task(void *context)
+		{
+			Acquisition *self = static_cast<Acquisition *>(context);
+			TickType_t wake = xTaskGetTickCount();
+			const TickType_t period = pdMS_TO_TICKS(self->m_period) > 0 ? pdMS_TO_TICKS(self->m_period) : 1;
+
+			while (self->m_running)
+			{
+				self->step();
+				vTaskDelayUntil(&wake, period);
+			}
+
+			self->m_finished = true;
+			vTaskDelete(nullptr);
+		}
+#elif defined(NUNCHUK_ACQUISITION_THREAD)
+		/**
+		 * @brief Einstiegspunkt des Threads
+		 */
+		void run()
+		{
+			auto wake = std::chrono::steady_clock::now();
+
+			while (m_running)
+			{
+				step();
+				wake += std::chrono::milliseconds(m_period);
+				std::this_thread::sleep_until(wake);
+			}
+		}
+#endif
+
+	private: // private Member
+		Device &m_device; // erfasstes Gerät
+		const unsigned long m_period; // Periode der Bustransaktionen in ms
+		StaticEventQueue<Sample, Length> m_queue; // Warteschlange zum Verbraucher
+		uint16_t m_sequence; // Nummer des nächsten Datensatzes
+#if defined(NUNCHUK_ACQUISITION_FREERTOS)
+		volatile bool m_running; // Task soll weiterlaufen
+		volatile bool m_finished; // Task hat sich beendet
+		TaskHandle_t m_task; // Handle des Tasks
+#elif defined(NUNCHUK_ACQUISITION_THREAD)
+		std::atomic<bool> m_running; // Thread soll weiterlaufen
+		std::thread m_thread; // Thread der Erfassung
+#else
+		bool m_running; // auf Plattformen ohne Tasks immer false
+#endif
+};
+
+} // namespace communication
+
+#endif // !ACQUISITION_H
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "AutoCenter.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	AutoCenter::AutoCenter(const uint8_t restRange, const uint8_t maxDrift)
+		: m_restRange{restRange},
+		m_maxDrift{maxDrift},
+		m_originX{0x80},
+		m_originY{0x80},
+		m_centerX{0x8000},
+		m_centerY{0x8000},
+		m_meanX{0x800},
+		m_meanY{0x800},
+		m_activity{0},
+		m_restCount{0}
+	{
+	}
+
+	void AutoCenter::reset(const uint8_t centerX, const uint8_t centerY)
+	{
+		m_originX = centerX;
+		m_originY = centerY;
+		m_centerX = static_cast<uint16_t>(centerX) << 8;
+		m_centerY = static_cast<uint16_t>(centerY) << 8;
+		m_meanX = static_cast<uint16_t>(centerX) << 4;
+		m_meanY = static_cast<uint16_t>(centerY) << 4;
+		m_activity = 0;
+		m_restCount = 0;
+	}
+
+	const bool AutoCenter::update(const uint8_t x, const uint8_t y, const bool pressed)
+	{
+		// kurzfristige Mittelwerte (Gewicht 1/4) und mittlere Abweichung davon als Maß der
+		// Bewegung, Rauschen eines losgelassenen Joysticks liegt darunter
+		m_meanX = m_meanX - (m_meanX >> 2) + (static_cast<uint16_t>(x) << 2);
+		m_meanY = m_meanY - (m_meanY >> 2) + (static_cast<uint16_t>(y) << 2);
+
+		const uint16_t sampleX = static_cast<uint16_t>(x) << 4;
+		const uint16_t sampleY = static_cast<uint16_t>(y) << 4;
+		const uint16_t deviation = ((sampleX > m_meanX) ? sampleX - m_meanX : m_meanX - sampleX)
+			+ ((sampleY > m_meanY) ? sampleY - m_meanY : m_meanY - sampleY);
+		m_activity = m_activity - (m_activity >> 2) + (deviation >> 2);
+
+		const uint8_t cX = centerX();
+		const uint8_t cY = centerY();
+		const bool nearCenter = ((x > cX) ? x - cX : cX - x) <= m_restRange
+			&& ((y > cY) ? y - cY : cY - y) <= m_restRange;
+
+		if (pressed || !nearCenter || m_activity > ACTIVITY_LIMIT)
+		{
+			m_restCount = 0;
+			return false;
+		}
+
+		if (m_restCount < SETTLE_SAMPLES)
+		{
+			m_restCount++;
+			return false;
+		}
+
+		track(m_centerX, m_originX, m_meanX);
+		track(m_centerY, m_originY, m_meanY);
+
+		return (centerX() != cX) || (centerY() != cY);
+	}
+
+	const uint8_t AutoCenter::centerX() const
+	{
+		return round(m_centerX);
+	}
+
+	const uint8_t AutoCenter::centerY() const
+	{
+		return round(m_centerY);
+	}
+
+	const bool AutoCenter::atRest() const
+	{
+		return m_restCount >= SETTLE_SAMPLES;
+	}
+
+	void AutoCenter::track(uint16_t &center, const uint8_t origin, const uint16_t mean) const
+	{
+		const uint16_t target = mean << 4;
+
+		if (target > center)
+		{
+			center += (target - center > MAX_STEP) ? MAX_STEP : target - center;
+		}
+		else
+		{
+			center -= (center - target > MAX_STEP) ? MAX_STEP : center - target;
+		}
+
+		// Verschiebung gegenüber dem Startwert begrenzen
+		const uint16_t lower = (origin > m_maxDrift) ? static_cast<uint16_t>(origin - m_maxDrift) << 8 : 0;
+		const uint16_t upper = (origin + m_maxDrift < 0xFF) ? static_cast<uint16_t>(origin + m_maxDrift) << 8 : 0xFF00;
+
+		if (center < lower)
+		{
+			center = lower;
+		}
+		else if (center > upper)
+		{
+			center = upper;
+		}
+	}
+} // namespace communication
@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   AutoCenter.h
+ *
+ * @brief  Klassendefinition eines Schätzers, der die Mittenwerte des Joysticks im
+ *         laufenden Betrieb nachführt
+ */
+
+#ifndef AUTO_CENTER_H
+#define AUTO_CENTER_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Schätzer der Mittenwerte des Joysticks. Nachgeführt wird nur, solange der Joystick
+ * 		  als losgelassen gilt: kein Button gedrückt, Position nahe der aktuellen Mitte und
+ * 		  geringe Streuung um den kurzfristigen Mittelwert über mindestens SETTLE_SAMPLES
+ * 		  Datensätze. Die Mitte ändert sich je
+ * 		  Datensatz um höchstens MAX_STEP und entfernt sich höchstens maxDrift Zählschritte
+ * 		  vom Startwert, sodass auch ein ruhig gehaltener, leicht ausgelenkter Joystick die
+ * 		  Mitte nur langsam verschiebt.
+ *
+ * 		  Je Datensatz konstanter Aufwand mit Ganzzahlarithmetik (Festkomma Q8), ohne
+ * 		  Multiplikation und Division.
+ */
+class AutoCenter
+{
+
+public: // public static Member
+	// Anzahl ruhiger Datensätze, bevor nachgeführt wird
+	static constexpr const uint8_t SETTLE_SAMPLES{16};
+
+	// größte Änderung der Mitte je Datensatz (Q8, entspricht 1/32 Zählschritt)
+	static constexpr const uint16_t MAX_STEP{8};
+
+	// größte mittlere Abweichung beider Achsen vom kurzfristigen Mittelwert, die noch als
+	// Ruhe gilt (Q4, entspricht 2 Zählschritten)
+	static constexpr const uint16_t ACTIVITY_LIMIT{32};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse AutoCenter.
+	 *
+	 * @param restRange größte Abweichung von der Mitte, die noch als Ruhelage gilt
+	 * @param maxDrift größte Verschiebung der Mitte gegenüber dem Startwert
+	 */
+	AutoCenter(const uint8_t restRange = 12, const uint8_t maxDrift = 24);
+
+	/**
+	 * @brief Setzt die Mittenwerte, z. B. aus der Kalibrierung des Geräts
+	 *
+	 * @param centerX Mittenwert links <-> rechts
+	 * @param centerY Mittenwert unten <-> oben
+	 */
+	void reset(const uint8_t centerX, const uint8_t centerY);
+
+	/**
+	 * @brief Übernimmt einen Datensatz
+	 *
+	 * @param x Rohwert des Joysticks links <-> rechts
+	 * @param y Rohwert des Joysticks unten <-> oben
+	 * @param pressed mindestens ein Button ist gedrückt
+	 * @return true gerundete Mittenwerte haben sich geändert
+	 */
+	const bool update(const uint8_t x, const uint8_t y, const bool pressed);
+
+	/**
+	 * @brief Gibt den geschätzten Mittenwert links <-> rechts zurück
+	 */
+	const uint8_t centerX() const;
+
+	/**
+	 * @brief Gibt den geschätzten Mittenwert unten <-> oben zurück
+	 */
+	const uint8_t centerY() const;
+
+	/**
+	 * @brief Gibt zurück, ob der Joystick beim letzten Datensatz als losgelassen galt
+	 */
+	const bool atRest() const;
+
+private: // private Methoden
+	/**
+	 * @brief Führt eine Achse der Mitte um höchstens MAX_STEP an den kurzfristigen
+	 * Mittelwert heran
+	 */
+	void track(uint16_t &center, const uint8_t origin, const uint16_t mean) const;
+
+	/**
+	 * @brief Rundet eine Mitte in Q8 auf ganze Zählschritte
+	 */
+	static const uint8_t round(const uint16_t center)
+	{
+		return static_cast<uint8_t>((center + 0x80) >> 8);
+	}
+
+private: // private Member
+	const uint8_t m_restRange; // größte Abweichung in Ruhelage
+	const uint8_t m_maxDrift; // größte Verschiebung gegenüber dem Startwert
+	uint8_t m_originX; // Startwert links <-> rechts
+	uint8_t m_originY; // Startwert unten <-> oben
+	uint16_t m_centerX; // Mitte links <-> rechts (Q8)
+	uint16_t m_centerY; // Mitte unten <-> oben (Q8)
+	uint16_t m_meanX; // kurzfristiger Mittelwert links <-> rechts (Q4)
+	uint16_t m_meanY; // kurzfristiger Mittelwert unten <-> oben (Q4)
+	uint16_t m_activity; // gleitende mittlere Abweichung vom Mittelwert (Q4)
+	uint8_t m_restCount; // Anzahl aufeinanderfolgender ruhiger Datensätze
+
+};
+
+/**
+ * @brief Policy von NunchukT für die Nachführung der Mittenwerte, siehe
+ * 		  NunchukT::setAutoCenter()
+ */
+class AutoCenterSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	AutoCenterSupport()
+	: m_estimator{nullptr}
+	{
+
+	}
+
+	/**
+	 * @brief Legt den Schätzer fest und startet ihn bei den aktuellen Mittenwerten
+	 */
+	void attach(AutoCenter &estimator, const uint8_t centerX, const uint8_t centerY)
+	{
+		m_estimator = &estimator;
+		reset(centerX, centerY);
+	}
+
+	/**
+	 * @brief Startet den Schätzer nach einer neuen Kalibrierung erneut, siehe AutoCenter::reset()
+	 */
+	void reset(const uint8_t centerX, const uint8_t centerY)
+	{
+		if (m_estimator)
+		{
+			m_estimator->reset(centerX, centerY);
+		}
+	}
+
+	/**
+	 * @brief Führt die Mittenwerte nach, siehe AutoCenter::update()
+	 *
+	 * @param centerX Mittenwert links <-> rechts, nur bei Änderung überschrieben
+	 * @param centerY Mittenwert unten <-> oben, nur bei Änderung überschrieben
+	 * @return true Mittenwerte geändert
+	 */
+	const bool update(const uint8_t x, const uint8_t y, const bool pressed, uint8_t &centerX, uint8_t &centerY)
+	{
+		if (!m_estimator || !m_estimator->update(x, y, pressed))
+		{
+			return false;
+		}
+
+		centerX = m_estimator->centerX();
+		centerY = m_estimator->centerY();
+		return true;
+	}
+
+private: // private Member
+	AutoCenter *m_estimator; // Schätzer, nullptr ohne Nachführung
+
+};
+
+} // namespace communication
+
+#endif // !AUTO_CENTER_H
@@ -0,0 +1,140 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "BusScheduler.h"
+
+#include <Arduino.h>
+
+#include "Clock.h"
+
+namespace communication
+{
+	BusScheduler::BusScheduler(const unsigned long slot)
+		: m_clients{},
+		m_slot{slot * 1000UL},
+		m_lastGrant{Clock::current() - slot * 1000UL},
+		m_count{0},
+		m_totalMisses{0}
+	{
+	}
+
+	uint8_t BusScheduler::attach(const unsigned long period, const unsigned long latency)
+	{
+		for (uint8_t id = 0; id < MAX_CLIENTS; id++)
+		{
+			Client &client = m_clients[id];
+
+			if (client.active)
+			{
+				continue;
+			}
+
+			client.period = ((period == 0) ? 1 : period) * 1000UL;
+			client.latency = (latency == 0) ? client.period : latency * 1000UL;
+			// erste Freigabe um die bereits belegten Zeitschlitze versetzen
+			client.release = Clock::current() + m_count * m_slot;
+			client.maxLateness = 0;
+			client.requested = 0;
+			client.misses = 0;
+			client.waiting = false;
+			client.active = true;
+
+			m_count++;
+			return id;
+		}
+
+		return INVALID_CLIENT;
+	}
+
+	void BusScheduler::detach(const uint8_t id)
+	{
+		if (id >= MAX_CLIENTS || !m_clients[id].active)
+		{
+			return;
+		}
+
+		m_clients[id].active = false;
+		m_count--;
+	}
+
+	const bool BusScheduler::request(const uint8_t id)
+	{
+		if (id >= MAX_CLIENTS || !m_clients[id].active)
+		{
+			return false;
+		}
+
+		const unsigned long now = Clock::current();
+		Client &client = m_clients[id];
+
+		// Periode noch nicht abgelaufen
+		if (!reached(now, client.release))
+		{
+			return false;
+		}
+
+		// ab hier wartet das Gerät auf den Bus, bis es freigegeben wird
+		client.waiting = true;
+		client.requested = now;
+
+		// Bus noch belegt
+		if ((now - m_lastGrant) < m_slot)
+		{
+			return false;
+		}
+
+		// einem anderen wartenden Gerät mit früherer Deadline den Vortritt lassen; Geräte, die
+		// nicht mehr anfragen, behalten ihre veraltete Deadline und würden sonst immer gewinnen
+		const unsigned long deadline = client.release + client.latency;
+		for (uint8_t other = 0; other < MAX_CLIENTS; other++)
+		{
+			const Client &competitor = m_clients[other];
+
+			if (other == id || !isWaiting(competitor, now))
+			{
+				continue;
+			}
+
+			if (static_cast<long>(deadline - (competitor.release + competitor.latency)) > 0)
+			{
+				return false;
+			}
+		}
+
+		const unsigned long lateness = now - client.release;
+		if (lateness > client.maxLateness)
+		{
+			client.maxLateness = lateness;
+		}
+
+		if (lateness > client.latency)
+		{
+			client.misses++;
+			m_totalMisses++;
+		}
+
+		// nächste Freigabe phasentreu setzen, übersprungene Perioden auslassen
+		client.release += client.period + (lateness / client.period) * client.period;
+		client.waiting = false;
+		m_lastGrant = now;
+
+		return true;
+	}
+
+	const uint16_t BusScheduler::misses(const uint8_t id) const
+	{
+		return (id < MAX_CLIENTS) ? m_clients[id].misses : 0;
+	}
+
+	const uint32_t BusScheduler::totalMisses() const
+	{
+		return m_totalMisses;
+	}
+
+	const unsigned long BusScheduler::maxLateness(const uint8_t id) const
+	{
+		return (id < MAX_CLIENTS) ? m_clients[id].maxLateness / 1000 : 0;
+	}
+} // namespace communication
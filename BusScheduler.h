@@ -0,0 +1,141 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   BusScheduler.h
+ *
+ * @brief  Klassendefinition eines kooperativen Schedulers, der periodische Transaktionen
+ *         mehrerer Geräte am selben I2C-Bus auf Zeitschlitze verteilt. Zeitpunkte stammen
+ *         von Clock::current(), Perioden und Verzögerungen werden in ms angegeben.
+ */
+
+#ifndef BUS_SCHEDULER_H
+#define BUS_SCHEDULER_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+class BusScheduler
+{
+
+public: // public static Member
+	// maximale Anzahl der Geräte pro Bus
+	static constexpr const uint8_t MAX_CLIENTS{8};
+
+	// Kennung eines ungültigen bzw. nicht registrierten Geräts
+	static constexpr const uint8_t INVALID_CLIENT{0xFF};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse BusScheduler.
+	 *
+	 * @param slot Mindestabstand zweier Transaktionen auf dem Bus in ms
+	 */
+	BusScheduler(const unsigned long slot = 2);
+
+	/**
+	 * @brief Registriert ein Gerät mit periodischen Transaktionen. Die erste Freigabe wird
+	 * 		  um die Anzahl der bereits registrierten Geräte in Zeitschlitzen versetzt, damit
+	 * 		  die Transaktionen nicht im selben Schleifendurchlauf zusammenfallen.
+	 *
+	 * @param period Periode der Transaktionen in ms
+	 * @param latency maximal zulässige Verzögerung nach der Freigabe in ms, 0 entspricht der Periode
+	 * @return uint8_t Kennung des Geräts, INVALID_CLIENT falls kein Platz mehr frei ist
+	 */
+	uint8_t attach(const unsigned long period, const unsigned long latency = 0);
+
+	/**
+	 * @brief Meldet ein Gerät wieder ab
+	 *
+	 * @param id Kennung des Geräts
+	 */
+	void detach(const uint8_t id);
+
+	/**
+	 * @brief Fragt an, ob das Gerät jetzt eine Transaktion durchführen darf.
+	 * 		  Freigegeben wird nur, wenn die Periode des Geräts abgelaufen ist, der Bus seit
+	 * 		  mindestens einem Zeitschlitz frei ist und kein anderes wartendes Gerät eine
+	 * 		  frühere Deadline hat (Earliest Deadline First). Als wartend gilt nur ein Gerät,
+	 * 		  das seit seiner Freigabe und innerhalb der letzten Periode angefragt hat; ein
+	 * 		  Gerät, das nicht mehr anfragt (z. B. getrennt), hält die übrigen nicht auf.
+	 *
+	 * @param id Kennung des Geräts
+	 * @return true Transaktion darf durchgeführt werden
+	 * @return false Gerät muss es später erneut versuchen
+	 */
+	const bool request(const uint8_t id);
+
+	/**
+	 * @brief Gibt die Anzahl der verpassten Deadlines eines Geräts zurück
+	 *
+	 * @param id Kennung des Geräts
+	 * @return uint16_t Anzahl verpasster Deadlines
+	 */
+	const uint16_t misses(const uint8_t id) const;
+
+	/**
+	 * @brief Gibt die Anzahl der verpassten Deadlines aller Geräte zurück
+	 *
+	 * @return uint32_t Anzahl verpasster Deadlines
+	 */
+	const uint32_t totalMisses() const;
+
+	/**
+	 * @brief Gibt die größte bisher gemessene Verzögerung zwischen Freigabe und
+	 * 		  Transaktion eines Geräts zurück
+	 *
+	 * @param id Kennung des Geräts
+	 * @return unsigned long maximale Verzögerung in ms
+	 */
+	const unsigned long maxLateness(const uint8_t id) const;
+
+private: // private Typen
+	/**
+	 * @brief Verwaltungsdaten eines registrierten Geräts
+	 */
+	struct Client
+	{
+		unsigned long period; // Periode der Transaktionen in µs
+		unsigned long latency; // zulässige Verzögerung nach der Freigabe in µs
+		unsigned long release; // Zeitpunkt der nächsten Freigabe (Clock::current())
+		unsigned long maxLateness; // größte gemessene Verzögerung in µs
+		unsigned long requested; // Zeitpunkt der letzten abgelehnten Anfrage
+		uint16_t misses; // Anzahl verpasster Deadlines
+		bool waiting; // Anfrage nach der Freigabe abgelehnt, noch nicht freigegeben
+		bool active; // Gerät ist registriert
+	};
+
+private: // private Methoden
+	/**
+	 * @brief Prüft, ob ein Gerät auf den Bus wartet, d. h. nach seiner Freigabe angefragt hat
+	 * 		  und seitdem nicht länger als eine Periode verstummt ist
+	 */
+	static const bool isWaiting(const Client &client, const unsigned long now)
+	{
+		return client.active && client.waiting && (now - client.requested) <= client.period;
+	}
+
+	/**
+	 * @brief Prüft, ob Zeitpunkt time bereits erreicht ist (überlaufsicher)
+	 */
+	static const bool reached(const unsigned long now, const unsigned long time)
+	{
+		return static_cast<long>(now - time) >= 0;
+	}
+
+private: // private Member
+	Client m_clients[MAX_CLIENTS]; // registrierte Geräte
+	const unsigned long m_slot; // Mindestabstand zweier Transaktionen in µs
+	unsigned long m_lastGrant; // Zeitpunkt der letzten Freigabe
+	uint8_t m_count; // Anzahl registrierter Geräte
+	uint32_t m_totalMisses; // verpasste Deadlines aller Geräte
+
+};
+
+} // namespace communication
+
+#endif // !BUS_SCHEDULER_H
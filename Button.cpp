@@ -1,17 +1,20 @@
 #include "Button.h"
 
-#include "Nunchuk.h"
-
 #include <Arduino.h>
 
 namespace communication
 {
-	Button::Button(const unsigned long duration)
-		: m_state{State::RELEASED},
-		m_duration{duration},
-		m_lastChange{millis()},
+	Button::Button(const unsigned long duration, const uint8_t id)
+		: m_pressedCallback{nullptr},
 		m_releasedCallback{nullptr},
-		m_pressedCallback{nullptr}
+		m_pressedDelegate{},
+		m_releasedDelegate{},
+		m_queue{nullptr},
+		m_timeout{},
+		m_duration{static_cast<uint16_t>(duration)},
+		m_state{State::RELEASED},
+		m_id{id},
+		m_device{0}
 	{
 	}
 
@@ -25,7 +28,7 @@ namespace communication
 			if (currentState == State::PRESSED)
 			{
 				m_state = State::PRESSED_TIMEOUT;
-				m_lastChange = millis();
+				m_timeout.start(m_duration * 1000UL);
 			}
 			break;
 		
@@ -33,15 +36,13 @@ namespace communication
 			if (currentState == State::RELEASED)
 			{
 				m_state = State::RELEASED;
+				m_timeout.stop();
 			}
-			else if ((millis() - m_lastChange) >= m_duration)
+			else if (m_timeout.expired())
 			{
 				m_state = State::PRESSED;
-
-				if (m_pressedCallback)
-				{
-					m_pressedCallback();
-				}
+				m_timeout.stop();
+				notify(ButtonEvent::Type::PRESSED);
 			}
 			break;
 		
@@ -49,7 +50,7 @@ namespace communication
 			if (currentState == State::RELEASED)
 			{
 				m_state = State::RELEASED_TIMEOUT;
-				m_lastChange = millis();
+				m_timeout.start(m_duration * 1000UL);
 			}
 			break;
 
@@ -57,15 +58,13 @@ namespace communication
 			if (currentState == State::PRESSED)
 			{
 				m_state = State::PRESSED;
+				m_timeout.stop();
 			}
-			else if ((millis() - m_lastChange) >= m_duration)
+			else if (m_timeout.expired())
 			{
 				m_state = State::RELEASED;
-
-				if (m_releasedCallback)
-				{
-					m_releasedCallback();
-				}
+				m_timeout.stop();
+				notify(ButtonEvent::Type::RELEASED);
 			}
 			break;
 		
@@ -74,6 +73,74 @@ namespace communication
 		}
 	}
 
+	void Button::notify(const ButtonEvent::Type type)
+	{
+		const ButtonEvent event{this, m_device, m_id, type, Clock::now()};
+
+		if (m_queue)
+		{
+			m_queue->push(event);
+			return;
+		}
+
+		dispatch(event);
+	}
+
+	void Button::dispatch(const ButtonEvent &event) const
+	{
+		if (event.type == ButtonEvent::Type::PRESSED)
+		{
+			if (m_pressedCallback)
+			{
+				m_pressedCallback();
+			}
+
+			if (m_pressedDelegate)
+			{
+				m_pressedDelegate(event);
+			}
+		}
+		else
+		{
+			if (m_releasedCallback)
+			{
+				m_releasedCallback();
+			}
+
+			if (m_releasedDelegate)
+			{
+				m_releasedDelegate(event);
+			}
+		}
+	}
+
+	uint8_t Button::drain(EventQueue<ButtonEvent> &queue)
+	{
+		ButtonEvent event;
+		uint8_t count = 0;
+
+		while (queue.pop(event))
+		{
+			event.source->dispatch(event);
+			count++;
+		}
+
+		return count;
+	}
+
+	void Button::release()
+	{
+		const bool pressed = isPressed();
+
+		m_state = State::RELEASED;
+		m_timeout.stop();
+
+		if (pressed)
+		{
+			notify(ButtonEvent::Type::RELEASED);
+		}
+	}
+
 	const bool Button::isPressed() const
 	{
 		return (m_state == State::PRESSED || m_state == State::RELEASED_TIMEOUT) ? true : false;
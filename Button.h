@@ -35,9 +35,37 @@
 
 #include <Arduino.h>
 
+#include "Clock.h"
+#include "Delegate.h"
+#include "EventQueue.h"
+
 namespace communication
 {
-class Nunchuk;
+class Button;
+
+/**
+ * @brief Zustandsänderung eines Buttons mit Zeitstempel
+ */
+struct ButtonEvent
+{
+	/**
+	 * @brief Art der Zustandsänderung
+	 */
+	enum class Type : uint8_t
+	{
+		PRESSED, // Button wurde gedrückt
+		RELEASED // Button wurde losgelassen
+	};
+
+	Button *source; // auslösender Button
+	uint8_t device; // Kennung des Geräts, siehe Button::attach()
+	uint8_t button; // Kennung des Buttons, siehe Konstruktor
+	Type type; // Art der Zustandsänderung
+	unsigned long timestamp; // Zeitpunkt der Zustandsänderung in µs, siehe Clock::now()
+};
+
+// Delegat, der bei einer Zustandsänderung mit dem Ereignis aufgerufen wird
+using ButtonDelegate = Delegate<void(const ButtonEvent &)>;
 
 class Button
 {
@@ -46,7 +74,7 @@ public: // Enumerationen
 	/**
 	 * @brief Zustände des Automaten
 	 */
-	enum class State
+	enum class State : uint8_t
 	{
 		RELEASED, // nicht gedrückt
 		PRESSED_TIMEOUT, // wird gedrückt, wartend auf Timeout
@@ -60,9 +88,11 @@ public: // public Methoden
 	 * 		  Setzt den Nunchuk, dessen Knopf geprüft werden soll, sowie die
 	 * 		  Zeit nach der er seinen neuen Zustand annehmen soll.
 	 * 
-	 * @param duration Zeitspanne, nachder die Zustandsänderung angenommen wird
+	 * @param duration Zeitspanne in ms, nachder die Zustandsänderung angenommen wird (höchstens
+	 * 		  65535 ms)
+	 * @param id Kennung des Buttons, wird in Ereignissen weitergegeben
 	 */
-	Button(const unsigned long duration = 30);
+	Button(const unsigned long duration = 30, const uint8_t id = 0);
 
 	/**
 	 * @brief Gibt den Gedrücktzustand zurück
@@ -101,11 +131,86 @@ public: // public Methoden
 	}
 
 	/**
-	 * @brief Bestimmt den Zutand des Buttons
+	 * @brief Registriert einen Delegaten, der beim Drücken des Buttons aufgerufen wird.
+	 *
+	 * @param pressedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+	*/
+	void onPressed(const ButtonDelegate pressedDelegate)
+	{
+		m_pressedDelegate = pressedDelegate;
+	}
+
+	/**
+	 * @brief Registriert einen Delegaten, der beim Loslassen des Buttons aufgerufen wird.
+	 *
+	 * @param releasedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+	*/
+	void onReleased(const ButtonDelegate releasedDelegate)
+	{
+		m_releasedDelegate = releasedDelegate;
+	}
+
+	/**
+	 * @brief Verbindet den Button mit einer Ereigniswarteschlange. Zustandsänderungen werden
+	 * 		  dann nur noch mit Zeitstempel angehängt, Callbacks und Delegaten laufen erst beim
+	 * 		  Abarbeiten der Warteschlange mit drain().
+	 *
+	 * @param queue Ereigniswarteschlange
+	 * @param device Kennung des Geräts, wird in Ereignissen weitergegeben
+	 */
+	void attach(EventQueue<ButtonEvent> &queue, const uint8_t device = 0)
+	{
+		m_queue = &queue;
+		m_device = device;
+	}
+
+	/**
+	 * @brief Trennt den Button von der Ereigniswarteschlange, Callbacks laufen wieder
+	 * 		  direkt in exec()
+	 */
+	void detach()
+	{
+		m_queue = nullptr;
+	}
+
+	/**
+	 * @brief Ruft Callback und Delegaten für ein Ereignis dieses Buttons auf
+	 *
+	 * @param event Ereignis
+	 */
+	void dispatch(const ButtonEvent &event) const;
+
+	/**
+	 * @brief Arbeitet alle vorliegenden Ereignisse einer Warteschlange ab und ruft jeweils
+	 * 		  Callback und Delegaten des auslösenden Buttons auf
+	 *
+	 * @param queue Ereigniswarteschlange
+	 * @return uint8_t Anzahl der abgearbeiteten Ereignisse
+	 */
+	static uint8_t drain(EventQueue<ButtonEvent> &queue);
+
+	/**
+	 * @brief Bestimmt den Zutand des Buttons zum zuletzt mit Clock::tick() abgetasteten
+	 * 		  Zeitpunkt
 	 * 
 	 */
 	void exec();
 
+	/**
+	 * @brief Setzt den Button ohne Entprellung auf losgelassen, z. B. wenn der Failsafe
+	 * 		  ausgelöst hat. War er gedrückt, wird das Loslassen gemeldet.
+	 */
+	void release();
+
+	/**
+	 * @brief Gibt den Zeitgeber der Entprellung zurück, er läuft nur während des Wartens
+	 * 		  auf das Timeout
+	 */
+	const Deadline &deadline() const
+	{
+		return m_timeout;
+	}
+
 private: // private-Methoden
 	/**
 	 * @brief Gibt den aktuellen Zustand des Buttons direkt von der Hardware zurück
@@ -115,12 +220,58 @@ private: // private-Methoden
 	 */
 	virtual const State getState() const = 0;
 
+	/**
+	 * @brief Meldet eine Zustandsänderung, entweder über die Warteschlange oder direkt
+	 *
+	 * @param type Art der Zustandsänderung
+	 */
+	void notify(const ButtonEvent::Type type);
+
 private: // private Member
-	const unsigned long m_duration; // Zeitspanne, die der Button mindestens gedrück sein muss
-	unsigned long m_lastChange; // Zeitpunkt der letzten Änderung des Gedrücktzustands
-	State m_state; // Zustand des Automaten
+	// Reihenfolge nach Größe, damit die kleinen Member (auch m_pressed von FrameButton) ohne
+	// Füllbytes am Ende liegen
 	void (*m_pressedCallback)(void);
 	void (*m_releasedCallback)(void);
+	ButtonDelegate m_pressedDelegate;
+	ButtonDelegate m_releasedDelegate;
+	EventQueue<ButtonEvent> *m_queue; // Ereigniswarteschlange, nullptr für direkte Aufrufe
+	Deadline m_timeout; // Ablauf der Entprellung nach der letzten Änderung des Gedrücktzustands
+	const uint16_t m_duration; // Zeitspanne, die der Button mindestens gedrück sein muss, in ms
+	State m_state; // Zustand des Automaten
+	const uint8_t m_id; // Kennung des Buttons
+	uint8_t m_device; // Kennung des Geräts
+
+};
+
+/**
+ * @brief Button, dessen Gedrücktzustand von außen, z. B. aus einem dekodierten Datensatz,
+ * 		  vorgegeben wird
+ */
+class FrameButton : public Button
+{
+
+public: // public Methoden
+	using Button::Button;
+
+	/**
+	 * @brief Übernimmt den aktuellen Gedrücktzustand und bestimmt den Zustand des Buttons
+	 *
+	 * @param pressed Button ist laut Hardware gedrückt
+	 */
+	void update(const bool pressed)
+	{
+		m_pressed = pressed;
+		exec();
+	}
+
+private: // private-Methoden
+	const State getState() const override
+	{
+		return m_pressed ? State::PRESSED : State::RELEASED;
+	}
+
+private: // private Member
+	bool m_pressed{false}; // zuletzt übernommener Gedrücktzustand
 
 };
 	
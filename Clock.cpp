@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Clock.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	NUNCHUK_CLOCK_LOCAL unsigned long Clock::s_now{0};
+	unsigned long Clock::s_offset{0};
+
+	void Clock::tick()
+	{
+		s_now = current();
+	}
+
+	void Clock::advance(const unsigned long us)
+	{
+#if defined(ARDUINO_ARCH_AVR)
+		// avr-gcc bietet keine atomaren 4-Byte-Operationen, daher mit gesperrten Interrupts
+		const uint8_t sreg = SREG;
+		cli();
+		s_offset += us;
+		SREG = sreg;
+#else
+		__atomic_fetch_add(&s_offset, us, __ATOMIC_RELAXED);
+#endif
+		s_now += us;
+	}
+
+	const unsigned long Clock::now()
+	{
+		return s_now;
+	}
+
+	const unsigned long Clock::current()
+	{
+#if defined(ARDUINO_ARCH_AVR)
+		// 4 Byte sind auf AVR nicht atomar lesbar, advance() kann aus einer ISR kommen
+		const uint8_t sreg = SREG;
+		cli();
+		const unsigned long offset = s_offset;
+		SREG = sreg;
+#else
+		const unsigned long offset = __atomic_load_n(&s_offset, __ATOMIC_RELAXED);
+#endif
+		return micros() + offset;
+	}
+
+	const bool Clock::reached(const unsigned long time)
+	{
+		return static_cast<long>(s_now - time) >= 0;
+	}
+
+	Deadline::Deadline()
+		: m_time{0},
+		m_armed{false}
+	{
+	}
+
+	void Deadline::start(const unsigned long us)
+	{
+		m_time = Clock::now() + us;
+		m_armed = true;
+	}
+
+	void Deadline::stop()
+	{
+		m_armed = false;
+	}
+
+	const bool Deadline::armed() const
+	{
+		return m_armed;
+	}
+
+	const bool Deadline::pending() const
+	{
+		return m_armed && !Clock::reached(m_time);
+	}
+
+	const bool Deadline::expired() const
+	{
+		return m_armed && Clock::reached(m_time);
+	}
+
+	const unsigned long Deadline::remaining() const
+	{
+		return remaining(Clock::now());
+	}
+
+	const unsigned long Deadline::remaining(const unsigned long now) const
+	{
+		if (!m_armed)
+		{
+			return Clock::NEVER;
+		}
+
+		return (static_cast<long>(now - m_time) >= 0) ? 0 : m_time - now;
+	}
+} // namespace communication
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Clock.h
+ *
+ * @brief  Klassendefinitionen einer einmal je Zyklus abgetasteten Uhr mit
+ *         Mikrosekundenauflösung sowie eines darauf aufbauenden Zeitgebers
+ */
+
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <Arduino.h>
+
+#if defined(ESP32) || !defined(ARDUINO)
+// Tasks bzw. Threads (siehe Acquisition) tasten jeweils ihre eigene Uhr ab
+#define NUNCHUK_CLOCK_LOCAL thread_local
+#else
+#define NUNCHUK_CLOCK_LOCAL
+#endif
+
+namespace communication
+{
+
+/**
+ * @brief Gemeinsame Zeitbasis aller Zeitgeber der Bibliothek. tick() liest micros() einmal
+ * je Zyklus, alle Zeitgeber vergleichen danach nur noch mit diesem Zeitpunkt. read() des
+ * Nunchuks ruft tick() selbst auf, eigene Buttons außerhalb des Treibers benötigen einen
+ * Aufruf je Schleifendurchlauf.
+ *
+ * Der abgetastete Zeitpunkt gilt je Task bzw. Thread, eine Erfassung im Hintergrund
+ * verändert damit nicht den Zeitpunkt des Hauptprogramms.
+ *
+ * Zeitpunkte werden überlaufsicher verglichen, Zeitspannen müssen daher kürzer als die halbe
+ * Überlaufperiode von micros() sein (auf AVR etwa 35 Minuten).
+ */
+class Clock
+{
+
+public: // public static Member
+	// Zeitspanne eines nicht laufenden Zeitgebers bzw. wenn kein Ereignis ansteht
+	static constexpr const unsigned long NEVER{~0UL};
+
+public: // public Methoden
+	/**
+	 * @brief Tastet die Uhr ab
+	 */
+	static void tick();
+
+	/**
+	 * @brief Gibt den zuletzt abgetasteten Zeitpunkt zurück
+	 *
+	 * @return unsigned long Zeitpunkt in µs
+	 */
+	static const unsigned long now();
+
+	/**
+	 * @brief Gibt den aktuellen Zeitpunkt zurück, ohne die Uhr abzutasten, z. B. als
+	 * Empfangszeitpunkt nach einem lange blockierenden Buszugriff
+	 *
+	 * @return unsigned long Zeitpunkt in µs
+	 */
+	static const unsigned long current();
+
+	/**
+	 * @brief Rechnet eine Zeitspanne ein, in der micros() stillstand (z. B. Power-Down mit
+	 * abgeschaltetem Timer 0). Die Uhr geht danach um diese Zeitspanne gegenüber micros() vor.
+	 *
+	 * @param us Zeitspanne in µs
+	 */
+	static void advance(const unsigned long us);
+
+	/**
+	 * @brief Prüft, ob der Zeitpunkt beim letzten Abtasten erreicht war (überlaufsicher)
+	 *
+	 * @param time Zeitpunkt in µs
+	 */
+	static const bool reached(const unsigned long time);
+
+private: // private Member
+	static NUNCHUK_CLOCK_LOCAL unsigned long s_now; // zuletzt abgetasteter Zeitpunkt in µs
+	static unsigned long s_offset; // Summe der Zeitspannen, in denen micros() stillstand (atomar)
+
+};
+
+/**
+ * @brief Zeitgeber mit einem Ablaufzeitpunkt auf Basis von Clock
+ */
+class Deadline
+{
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse Deadline. Der Zeitgeber läuft nicht.
+	 */
+	Deadline();
+
+	/**
+	 * @brief Startet den Zeitgeber relativ zum zuletzt abgetasteten Zeitpunkt
+	 *
+	 * @param us Zeitspanne bis zum Ablauf in µs
+	 */
+	void start(const unsigned long us);
+
+	/**
+	 * @brief Hält den Zeitgeber an
+	 */
+	void stop();
+
+	/**
+	 * @brief Gibt zurück, ob der Zeitgeber läuft (abgelaufen oder nicht)
+	 */
+	const bool armed() const;
+
+	/**
+	 * @brief Gibt zurück, ob der Zeitgeber läuft und noch nicht abgelaufen ist
+	 */
+	const bool pending() const;
+
+	/**
+	 * @brief Gibt zurück, ob der Zeitgeber läuft und abgelaufen ist
+	 */
+	const bool expired() const;
+
+	/**
+	 * @brief Gibt die verbleibende Zeitspanne bis zum Ablauf zurück
+	 *
+	 * @return unsigned long Zeitspanne in µs, 0 falls abgelaufen, Clock::NEVER falls angehalten
+	 */
+	const unsigned long remaining() const;
+
+	/**
+	 * @brief Gibt die verbleibende Zeitspanne ab dem übergebenen Zeitpunkt zurück
+	 *
+	 * @param now Zeitpunkt in µs, z. B. Clock::current()
+	 * @return unsigned long Zeitspanne in µs, 0 falls abgelaufen, Clock::NEVER falls angehalten
+	 */
+	const unsigned long remaining(const unsigned long now) const;
+
+private: // private Member
+	unsigned long m_time; // Ablaufzeitpunkt in µs
+	bool m_armed; // Zeitgeber läuft
+
+};
+
+} // namespace communication
+
+#endif // !CLOCK_H
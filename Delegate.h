@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef DELEGATE_H
+#define DELEGATE_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+template<
+	class Signature
+>
+class Delegate;
+
+/**
+ * @brief Klassen-Template eines Delegaten aus Funktionszeiger und Kontextzeiger.
+ * Benötigt keinen dynamischen Speicher; der Kontext (z. B. ein Objekt) wird der Funktion
+ * beim Aufruf als erstes Argument übergeben.
+ *
+ * @tparam R Rückgabetyp
+ * @tparam Args Argumenttypen
+ */
+template<
+	class R,
+	class... Args
+>
+class Delegate<R(Args...)>
+{
+	public: // public typedefs
+		using Function = R (*)(void *context, Args... args);
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert einen leeren Delegaten
+		 */
+		constexpr Delegate()
+		: m_function{nullptr},
+		  m_context{nullptr}
+		{
+
+		}
+
+		/**
+		 * @brief Kontruiert einen Delegaten aus Funktion und Kontext
+		 *
+		 * @param function aufzurufende Funktion
+		 * @param context Kontext, der der Funktion übergeben wird
+		 */
+		constexpr Delegate(Function function, void *context = nullptr)
+		: m_function{function},
+		  m_context{context}
+		{
+
+		}
+
+		/**
+		 * @brief Erzeugt einen Delegaten, der eine Methode des übergebenen Objekts aufruft
+		 *
+		 * @tparam C Klasse des Objekts
+		 * @tparam Method aufzurufende Methode
+		 * @param object Referenz auf das Objekt
+		 * @return Delegate Delegat auf die Methode
+		 */
+		template<
+			class C,
+			R (C::*Method)(Args...)
+		>
+		static Delegate fromMethod(C &object)
+		{
+			return Delegate{&invokeMethod<C, Method>, &object};
+		}
+
+		/**
+		 * @brief Gibt zurück, ob eine Funktion hinterlegt ist
+		 */
+		explicit operator bool() const
+		{
+			return m_function != nullptr;
+		}
+
+		/**
+		 * @brief Ruft die hinterlegte Funktion mit dem Kontext auf
+		 *
+		 * @param args Argumente des Aufrufs
+		 * @return R Rückgabewert der Funktion
+		 */
+		R operator()(Args... args) const
+		{
+			return m_function(m_context, args...);
+		}
+
+		/**
+		 * @brief Gibt den hinterlegten Kontext zurück
+		 */
+		void *context() const
+		{
+			return m_context;
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Brückenfunktion für Methodenaufrufe
+		 */
+		template<
+			class C,
+			R (C::*Method)(Args...)
+		>
+		static R invokeMethod(void *context, Args... args)
+		{
+			return (static_cast<C *>(context)->*Method)(args...);
+		}
+
+	private: // private Member
+		Function m_function; // aufzurufende Funktion
+		void *m_context; // Kontext des Aufrufs
+};
+
+} // namespace communication
+
+#endif // !DELEGATE_H
@@ -0,0 +1,169 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "DifferentialDrive.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	const uint16_t MotorCommand::leftDuty() const
+	{
+		return (left < 0) ? -left : left;
+	}
+
+	const uint16_t MotorCommand::rightDuty() const
+	{
+		return (right < 0) ? -right : right;
+	}
+
+	const bool MotorCommand::leftForward() const
+	{
+		return left >= 0;
+	}
+
+	const bool MotorCommand::rightForward() const
+	{
+		return right >= 0;
+	}
+
+	DifferentialDrive::DifferentialDrive(const uint16_t pwmMax)
+		: m_command{0, 0},
+		m_pwmMax{pwmMax},
+		m_pwmScale{static_cast<uint16_t>((static_cast<uint32_t>(pwmMax) << 8) / INPUT_MAX)},
+		m_deadzone{0},
+		m_deadzoneGain{UNITY_GAIN},
+		m_expo{0},
+		m_turnGain{UNITY_GAIN},
+		m_slewStep{0}
+	{
+	}
+
+	void DifferentialDrive::setDeadzone(const uint8_t deadzone)
+	{
+		m_deadzone = (deadzone < INPUT_MAX) ? deadzone : INPUT_MAX - 1;
+		// aufrunden, damit der Vollausschlag erreicht wird, Überschreitungen werden begrenzt
+		const uint16_t range = INPUT_MAX - m_deadzone;
+		m_deadzoneGain = static_cast<uint16_t>(((static_cast<uint32_t>(INPUT_MAX) << 8) + range - 1) / range);
+	}
+
+	void DifferentialDrive::setExpo(const uint8_t expo)
+	{
+		m_expo = expo;
+	}
+
+	void DifferentialDrive::setTurnGain(const uint16_t gain)
+	{
+		m_turnGain = (gain < MAX_TURN_GAIN) ? gain : MAX_TURN_GAIN;
+	}
+
+	void DifferentialDrive::setSlewRate(const uint16_t step)
+	{
+		m_slewStep = step;
+	}
+
+	const MotorCommand &DifferentialDrive::update(const int16_t x, const int16_t y)
+	{
+		const int16_t throttle = shape(y);
+		const int32_t turn = (static_cast<int32_t>(shape(x)) * m_turnGain) / UNITY_GAIN;
+
+		int32_t left = throttle + turn;
+		int32_t right = throttle - turn;
+
+		// bei Übersteuerung beide Seiten gleichmäßig skalieren, damit der Kurvenradius erhalten bleibt
+		// (|left|, |right| <= 5 * INPUT_MAX, die Produkte mit INPUT_MAX benötigen 32 Bit)
+		const int32_t absLeft = (left < 0) ? -left : left;
+		const int32_t absRight = (right < 0) ? -right : right;
+		const int32_t magnitude = (absLeft > absRight) ? absLeft : absRight;
+		if (magnitude > INPUT_MAX)
+		{
+			left = (left * INPUT_MAX) / magnitude;
+			right = (right * INPUT_MAX) / magnitude;
+		}
+
+		m_command.left = slew(m_command.left, scale(static_cast<int16_t>(left)));
+		m_command.right = slew(m_command.right, scale(static_cast<int16_t>(right)));
+		return m_command;
+	}
+
+	const MotorCommand &DifferentialDrive::command() const
+	{
+		return m_command;
+	}
+
+	void DifferentialDrive::reset()
+	{
+		m_command = MotorCommand{0, 0};
+	}
+
+	const int16_t DifferentialDrive::shape(const int16_t value) const
+	{
+		uint16_t magnitude = (value < 0) ? -value : value;
+
+		if (magnitude > INPUT_MAX)
+		{
+			magnitude = INPUT_MAX;
+		}
+
+		if (magnitude <= m_deadzone)
+		{
+			return 0;
+		}
+
+		// Totbereich abziehen und auf den vollen Bereich strecken
+		magnitude = static_cast<uint16_t>((static_cast<uint32_t>(magnitude - m_deadzone) * m_deadzoneGain) >> 8);
+		if (magnitude > INPUT_MAX)
+		{
+			magnitude = INPUT_MAX;
+		}
+
+		// Kennlinie: (1 - e) * a + e * a^3, a^3 auf INPUT_MAX normiert
+		if (m_expo > 0)
+		{
+			// Division durch INPUT_MAX^2 als Multiplikation mit 65 / 2^20 (Fehler < 0,02 %)
+			const uint16_t cube = static_cast<uint16_t>((static_cast<uint32_t>(magnitude * magnitude) * magnitude * 65
+				+ 0x80000UL) >> 20);
+			magnitude = static_cast<uint16_t>((static_cast<uint32_t>(magnitude) * (256 - m_expo)
+				+ static_cast<uint32_t>(cube) * m_expo) >> 8);
+		}
+
+		return (value < 0) ? -static_cast<int16_t>(magnitude) : static_cast<int16_t>(magnitude);
+	}
+
+	const int16_t DifferentialDrive::scale(const int16_t value) const
+	{
+		const uint16_t magnitude = (value < 0) ? -value : value;
+		uint16_t duty = static_cast<uint16_t>((static_cast<uint32_t>(magnitude) * m_pwmScale + 0x80) >> 8);
+
+		if (duty > m_pwmMax)
+		{
+			duty = m_pwmMax;
+		}
+
+		return (value < 0) ? -static_cast<int16_t>(duty) : static_cast<int16_t>(duty);
+	}
+
+	const int16_t DifferentialDrive::slew(const int16_t current, const int16_t target) const
+	{
+		if (m_slewStep == 0)
+		{
+			return target;
+		}
+
+		const int32_t delta = static_cast<int32_t>(target) - current;
+
+		if (delta > m_slewStep)
+		{
+			return current + m_slewStep;
+		}
+
+		if (delta < -static_cast<int32_t>(m_slewStep))
+		{
+			return current - m_slewStep;
+		}
+
+		return target;
+	}
+} // namespace communication
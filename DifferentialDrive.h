@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   DifferentialDrive.h
+ *
+ * @brief  Klassendefinition eines Mischers, der Joystickwerte in Stellwerte für den linken
+ *         und rechten Motor eines Differentialantriebs umrechnet (Festkomma)
+ */
+
+#ifndef DIFFERENTIAL_DRIVE_H
+#define DIFFERENTIAL_DRIVE_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Stellwerte beider Motoren. Das Vorzeichen gibt die Drehrichtung an, der Betrag das
+ * 		  Tastverhältnis der PWM in [0;pwmMax].
+ */
+struct MotorCommand
+{
+	int16_t left; // Stellwert des linken Motors
+	int16_t right; // Stellwert des rechten Motors
+
+	/**
+	 * @brief Gibt das Tastverhältnis des linken Motors zurück, z. B. für analogWrite()
+	 */
+	const uint16_t leftDuty() const;
+
+	/**
+	 * @brief Gibt das Tastverhältnis des rechten Motors zurück
+	 */
+	const uint16_t rightDuty() const;
+
+	/**
+	 * @brief Gibt zurück, ob der linke Motor vorwärts dreht
+	 */
+	const bool leftForward() const;
+
+	/**
+	 * @brief Gibt zurück, ob der rechte Motor vorwärts dreht
+	 */
+	const bool rightForward() const;
+};
+
+/**
+ * @brief Mischer für Differentialantriebe (Panzersteuerung). Y steuert die Fahrt, X die
+ * 		  Lenkung. Jede Achse durchläuft Totbereich und Kennlinie, anschließend werden beide
+ * 		  Achsen gemischt, bei Übersteuerung proportional skaliert, auf den PWM-Bereich
+ * 		  abgebildet und in der Änderungsrate begrenzt.
+ *
+ * 		  Die Berechnung erfolgt vollständig in Ganzzahlarithmetik, Divisionen durch
+ * 		  Parameter werden in den Settern vorausberechnet. Aufwand je Aufruf von update():
+ * 		  höchstens 13 Multiplikationen (davon 10 mit 32-Bit-Ergebnis), 2 Divisionen 32/32 Bit
+ * 		  (nur bei Übersteuerung), sonst Additionen, Vergleiche und Schiebeoperationen.
+ * 		  Auf einem AVR mit 16 MHz entspricht das geschätzt rund 800 Takten (ca. 50 µs), bei
+ * 		  Übersteuerung zusätzlich rund 1300 Takten für die Divisionen.
+ */
+class DifferentialDrive
+{
+
+public: // public static Member
+	// Betrag des größten verarbeiteten Joystickwerts
+	static constexpr const int16_t INPUT_MAX{127};
+
+	// Faktor 1,0 für die Lenkverstärkung (Festkomma Q8)
+	static constexpr const uint16_t UNITY_GAIN{256};
+
+	// größte Lenkverstärkung (Faktor 4,0)
+	static constexpr const uint16_t MAX_TURN_GAIN{4 * UNITY_GAIN};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse DifferentialDrive.
+	 *
+	 * @param pwmMax Tastverhältnis bei Vollausschlag, z. B. 255 für analogWrite()
+	 */
+	DifferentialDrive(const uint16_t pwmMax = 255);
+
+	/**
+	 * @brief Setzt den Totbereich um die Mitte. Außerhalb wird so skaliert, dass der
+	 * 		  Stellwert ohne Sprung bei 0 beginnt und bei Vollausschlag das Maximum erreicht.
+	 *
+	 * @param deadzone Totbereich in Joystickeinheiten [0;INPUT_MAX)
+	 */
+	void setDeadzone(const uint8_t deadzone);
+
+	/**
+	 * @brief Setzt die Kennlinie als Mischung aus linearem und kubischem Verlauf.
+	 * 		  Größere Werte ergeben feinfühligere Steuerung um die Mitte.
+	 *
+	 * @param expo 0 linear bis 255 nahezu kubisch
+	 */
+	void setExpo(const uint8_t expo);
+
+	/**
+	 * @brief Setzt die Verstärkung der Lenkung
+	 *
+	 * @param gain Verstärkung in Festkomma Q8, UNITY_GAIN entspricht 1,0, höchstens MAX_TURN_GAIN
+	 */
+	void setTurnGain(const uint16_t gain);
+
+	/**
+	 * @brief Begrenzt die Änderung der Stellwerte je Aufruf von update(). Bei einer
+	 * 		  Zykluszeit von 30 ms und einem Maximum von 255 erlaubt z. B. ein Wert von 16 eine
+	 * 		  Änderung von Stillstand auf Vollgas in knapp 0,5 s.
+	 *
+	 * @param step maximale Änderung je Aufruf, 0 schaltet die Begrenzung ab
+	 */
+	void setSlewRate(const uint16_t step);
+
+	/**
+	 * @brief Berechnet die Stellwerte für eine neue Joystickposition
+	 *
+	 * @param x Joystickwert links <-> rechts, z. B. decodeJoystickX()
+	 * @param y Joystickwert unten <-> oben, z. B. decodeJoystickY()
+	 * @return const MotorCommand& aktuelle Stellwerte
+	 */
+	const MotorCommand &update(const int16_t x, const int16_t y);
+
+	/**
+	 * @brief Gibt die zuletzt berechneten Stellwerte zurück
+	 *
+	 * @return const MotorCommand& aktuelle Stellwerte
+	 */
+	const MotorCommand &command() const;
+
+	/**
+	 * @brief Setzt die Stellwerte ohne Rampe auf Stillstand
+	 */
+	void reset();
+
+private: // private Methoden
+	/**
+	 * @brief Wendet Totbereich und Kennlinie auf einen Joystickwert an
+	 *
+	 * @param value Joystickwert
+	 * @return int16_t geformter Wert in [-INPUT_MAX;INPUT_MAX]
+	 */
+	const int16_t shape(const int16_t value) const;
+
+	/**
+	 * @brief Bildet einen gemischten Wert auf den PWM-Bereich ab
+	 */
+	const int16_t scale(const int16_t value) const;
+
+	/**
+	 * @brief Nähert den aktuellen Stellwert unter Beachtung der Änderungsrate dem Zielwert an
+	 */
+	const int16_t slew(const int16_t current, const int16_t target) const;
+
+private: // private Member
+	MotorCommand m_command; // aktuelle Stellwerte
+	const uint16_t m_pwmMax; // Tastverhältnis bei Vollausschlag
+	uint16_t m_pwmScale; // Abbildung auf den PWM-Bereich (Q8)
+	uint8_t m_deadzone; // Totbereich
+	uint16_t m_deadzoneGain; // Skalierung außerhalb des Totbereichs (Q8)
+	uint8_t m_expo; // Anteil des kubischen Verlaufs (Q8)
+	uint16_t m_turnGain; // Verstärkung der Lenkung (Q8)
+	uint16_t m_slewStep; // maximale Änderung je Aufruf
+
+};
+
+} // namespace communication
+
+#endif // !DIFFERENTIAL_DRIVE_H
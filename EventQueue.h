@@ -0,0 +1,177 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Klassen-Template einer Ereigniswarteschlange fester Größe für genau einen Erzeuger
+ * und einen Verbraucher. Erzeuger und Verbraucher dürfen sich gegenseitig unterbrechen
+ * (z. B. Erzeuger in einer ISR) oder in verschiedenen Tasks bzw. Threads laufen, ohne dass
+ * Interrupts gesperrt oder Sperren verwendet werden müssen.
+ * Der Speicher wird von StaticEventQueue bereitgestellt.
+ *
+ * @tparam T Datentyp der Ereignisse
+ */
+template<
+	class T
+>
+class EventQueue
+{
+	public: // public typedefs
+		using value_type = T;
+		using size_type = uint8_t;
+
+	public: // public Methoden
+		/**
+		 * @brief Hängt ein Ereignis an. Ist die Warteschlange voll, wird das Ereignis
+		 * verworfen und gezählt.
+		 *
+		 * @param event Referenz auf das Ereignis
+		 * @return true Ereignis angehängt
+		 * @return false Warteschlange voll
+		 */
+		const bool push(const T& event)
+		{
+			const uint8_t head = load(m_head);
+			const uint8_t next = (head + 1) % m_capacity;
+
+			if (next == load(m_tail))
+			{
+				m_dropped++;
+				return false;
+			}
+
+			m_storage[head] = event;
+			store(m_head, next);
+			return true;
+		}
+
+		/**
+		 * @brief Entnimmt das älteste Ereignis
+		 *
+		 * @param event Referenz auf das Ziel
+		 * @return true Ereignis entnommen
+		 * @return false Warteschlange leer
+		 */
+		const bool pop(T& event)
+		{
+			const uint8_t tail = load(m_tail);
+
+			if (tail == load(m_head))
+			{
+				return false;
+			}
+
+			event = m_storage[tail];
+			store(m_tail, static_cast<uint8_t>((tail + 1) % m_capacity));
+			return true;
+		}
+
+		/**
+		 * @brief Gibt zurück, ob Ereignisse vorliegen
+		 */
+		const bool empty() const
+		{
+			return load(m_tail) == load(m_head);
+		}
+
+		/**
+		 * @brief Gibt die Anzahl der vorliegenden Ereignisse zurück
+		 */
+		const size_type size() const
+		{
+			return (load(m_head) + m_capacity - load(m_tail)) % m_capacity;
+		}
+
+		/**
+		 * @brief Gibt die Anzahl der wegen Überlaufs verworfenen Ereignisse zurück
+		 */
+		const uint16_t dropped() const
+		{
+			return m_dropped;
+		}
+
+	protected: // protected Methoden
+		/**
+		 * @brief Kontruiert eine Warteschlange auf fremdem Speicher
+		 *
+		 * @param storage Zeiger auf den Speicher
+		 * @param capacity Anzahl der Elemente des Speichers, nutzbar sind capacity - 1
+		 */
+		EventQueue(T *storage, const uint8_t capacity)
+		: m_storage{storage},
+		  m_capacity{capacity},
+		  m_head{0},
+		  m_tail{0},
+		  m_dropped{0}
+		{
+
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Liest einen Index mit Acquire-Semantik, nachfolgende Zugriffe auf die Elemente
+		 * werden nicht davor gezogen (auf AVR eine einfache Ladeoperation)
+		 */
+		static uint8_t load(const uint8_t &index)
+		{
+			return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+		}
+
+		/**
+		 * @brief Schreibt einen Index mit Release-Semantik, vorherige Zugriffe auf die Elemente
+		 * sind danach für die Gegenseite sichtbar, auch auf einem anderen Kern
+		 */
+		static void store(uint8_t &index, const uint8_t value)
+		{
+			__atomic_store_n(&index, value, __ATOMIC_RELEASE);
+		}
+
+	private: // private Member
+		T *m_storage; // Speicher der Elemente
+		const uint8_t m_capacity; // Anzahl der Elemente des Speichers
+		uint8_t m_head; // nächste Schreibposition (nur Erzeuger)
+		uint8_t m_tail; // nächste Leseposition (nur Verbraucher)
+		uint16_t m_dropped; // verworfene Ereignisse
+};
+
+/**
+ * @brief Klassen-Template einer Ereigniswarteschlange mit eigenem statischen Speicher
+ *
+ * @tparam T Datentyp der Ereignisse
+ * @tparam Length Anzahl der Ereignisse, die gleichzeitig vorliegen können
+ */
+template<
+	class T,
+	uint8_t Length
+>
+class StaticEventQueue : public EventQueue<T>
+{
+	static_assert(Length > 0 && Length < 0xFF, "Length muss in [1;254] liegen");
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert eine neue, leere Warteschlange
+		 */
+		StaticEventQueue()
+		: EventQueue<T>(m_data, Length + 1),
+		  m_data{}
+		{
+
+		}
+
+	private: // private Member
+		T m_data[Length + 1]; // zugrundeliegender Speicher
+};
+
+} // namespace communication
+
+#endif // !EVENT_QUEUE_H
@@ -0,0 +1,147 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Failsafe.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	Failsafe::Failsafe(const unsigned long deadline, const unsigned long margin)
+		: m_deadline{deadline * 1000UL},
+		m_timeout{((margin < deadline) ? deadline - margin : 0) * 1000UL},
+		m_timer{},
+		m_lastFresh{0},
+		m_worst{0},
+		m_engagements{0},
+		m_overruns{0},
+		m_delegate{},
+		m_queue{nullptr},
+		m_device{0},
+		m_engaged{true},
+		m_fed{false}
+	{
+	}
+
+	void Failsafe::feed()
+	{
+		// Empfangszeitpunkt statt des zu Beginn von read() abgetasteten Zeitpunkts, sonst
+		// löste ein lange blockierender Buszugriff beim nächsten Aufruf grundlos aus
+		const unsigned long now = Clock::current();
+
+		// blockierte read() länger als die Reserve, war die Frist unbemerkt überschritten
+		if (m_fed && !m_engaged && (now - m_lastFresh > m_deadline))
+		{
+			m_worst = (now - m_lastFresh > m_worst) ? now - m_lastFresh : m_worst;
+			m_overruns++;
+		}
+
+		m_lastFresh = now;
+		m_fed = true;
+		m_timer.start(m_timeout + (now - Clock::now()));
+
+		if (m_engaged)
+		{
+			m_engaged = false;
+			notify(FailsafeEvent::Type::RELEASED, FailsafeEvent::Cause::NONE, 0);
+		}
+	}
+
+	const bool Failsafe::check()
+	{
+		if (m_engaged || !m_timer.expired())
+		{
+			return false;
+		}
+
+		engage(FailsafeEvent::Cause::TIMEOUT);
+		return true;
+	}
+
+	const bool Failsafe::disconnected()
+	{
+		if (m_engaged)
+		{
+			return false;
+		}
+
+		engage(FailsafeEvent::Cause::DISCONNECTED);
+		return true;
+	}
+
+	void Failsafe::reset()
+	{
+		m_timer.stop();
+		m_engaged = true;
+		m_fed = false;
+	}
+
+	const bool Failsafe::engaged() const
+	{
+		return m_engaged;
+	}
+
+	const unsigned long Failsafe::age() const
+	{
+		if (!m_fed)
+		{
+			return Clock::NEVER;
+		}
+
+		return Clock::reached(m_lastFresh) ? Clock::now() - m_lastFresh : 0;
+	}
+
+	const unsigned long Failsafe::worstLatency() const
+	{
+		return m_worst;
+	}
+
+	const uint32_t Failsafe::engagements() const
+	{
+		return m_engagements;
+	}
+
+	const uint32_t Failsafe::overruns() const
+	{
+		return m_overruns;
+	}
+
+	void Failsafe::resetStatistics()
+	{
+		m_worst = 0;
+		m_engagements = 0;
+		m_overruns = 0;
+	}
+
+	void Failsafe::engage(const FailsafeEvent::Cause cause)
+	{
+		const unsigned long age = this->age();
+
+		m_worst = (age > m_worst) ? age : m_worst;
+		m_overruns += (age > m_deadline) ? 1 : 0;
+		m_engagements++;
+		m_engaged = true;
+		m_timer.stop();
+
+		notify(FailsafeEvent::Type::ENGAGED, cause, age);
+	}
+
+	void Failsafe::notify(const FailsafeEvent::Type type, const FailsafeEvent::Cause cause,
+		const unsigned long age)
+	{
+		const FailsafeEvent event{m_device, type, cause, age, Clock::now()};
+
+		if (m_queue)
+		{
+			m_queue->push(event);
+			return;
+		}
+
+		if (m_delegate)
+		{
+			m_delegate(event);
+		}
+	}
+} // namespace communication
@@ -0,0 +1,301 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Failsafe.h
+ *
+ * @brief  Klassendefinition einer Totmannüberwachung, die bei ausbleibenden Datensätzen
+ *         innerhalb einer festen Frist neutrale Ausgaben erzwingt
+ */
+
+#ifndef FAILSAFE_H
+#define FAILSAFE_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Delegate.h"
+#include "EventQueue.h"
+
+namespace communication
+{
+
+/**
+ * @brief Auslösen bzw. Aufheben des Failsafe mit Zeitstempel
+ */
+struct FailsafeEvent
+{
+	/**
+	 * @brief Art des Ereignisses
+	 */
+	enum class Type : uint8_t
+	{
+		ENGAGED, // Failsafe ausgelöst, Ausgaben neutral
+		RELEASED // wieder frische Datensätze, Ausgaben folgen dem Gerät
+	};
+
+	/**
+	 * @brief Ursache des Auslösens
+	 */
+	enum class Cause : uint8_t
+	{
+		NONE, // beim Aufheben
+		TIMEOUT, // seit der Frist kein frischer Datensatz
+		DISCONNECTED // Verbindung verloren
+	};
+
+	uint8_t device; // Kennung des Geräts, siehe Failsafe::attach()
+	Type type; // Art des Ereignisses
+	Cause cause; // Ursache des Auslösens
+	unsigned long age; // Alter des letzten frischen Datensatzes beim Auslösen in µs
+	unsigned long timestamp; // Zeitpunkt des Ereignisses in µs, siehe Clock::now()
+};
+
+// Delegat, der beim Auslösen und Aufheben aufgerufen wird
+using FailsafeDelegate = Delegate<void(const FailsafeEvent &)>;
+
+/**
+ * @brief Totmannüberwachung eines Geräts. Jeder vollständige, plausible Datensatz (auch ein
+ * unveränderter) setzt das Alter zurück. Bleiben frische Datensätze länger als deadline -
+ * margin aus oder geht die Verbindung verloren, löst der Failsafe aus: der Nunchuk
+ * veröffentlicht einen neutralen Datensatz (Joystick in der Mitte, Beschleunigung 0, Buttons
+ * losgelassen), decode*() und die Buttons liefern damit neutrale Werte, und ein Ereignis
+ * wird gemeldet. Der nächste frische Datensatz hebt den Failsafe wieder auf. Bis zum ersten
+ * frischen Datensatz ist der Failsafe ausgelöst (ohne Ereignis).
+ *
+ * Der Zeitgeber ist Teil der Zeitgeber des Nunchuks, timeUntilNextEvent() und der PowerSaver
+ * berücksichtigen ihn. Die Frist wird eingehalten, solange read() mindestens alle margin
+ * aufgerufen wird und ein einzelner Aufruf nicht länger als margin blockiert. Zur
+ * Überprüfung wird das größte Alter beim Auslösen festgehalten und jede Überschreitung der
+ * Frist gezählt.
+ */
+class Failsafe
+{
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse Failsafe. Der Failsafe ist ausgelöst.
+	 *
+	 * @param deadline zugesicherte Frist in ms, nach der ohne frische Datensätze ausgelöst ist
+	 * @param margin Reserve in ms für Abfrageabstand und Laufzeit von read(), kleiner als
+	 * deadline
+	 */
+	Failsafe(const unsigned long deadline = 100, const unsigned long margin = 20);
+
+	/**
+	 * @brief Meldet einen frischen Datensatz zum zuletzt abgetasteten Zeitpunkt und hebt den
+	 * Failsafe ggf. auf (Nunchuk)
+	 */
+	void feed();
+
+	/**
+	 * @brief Prüft das Alter des letzten frischen Datensatzes (Nunchuk)
+	 *
+	 * @return true Failsafe mit diesem Aufruf ausgelöst
+	 */
+	const bool check();
+
+	/**
+	 * @brief Meldet den Verlust der Verbindung (Nunchuk)
+	 *
+	 * @return true Failsafe mit diesem Aufruf ausgelöst
+	 */
+	const bool disconnected();
+
+	/**
+	 * @brief Versetzt den Failsafe ohne Ereignis in den ausgelösten Zustand wie nach dem
+	 * Konstruieren
+	 */
+	void reset();
+
+	/**
+	 * @brief Registriert einen Delegaten, der beim Auslösen und Aufheben aufgerufen wird,
+	 * z. B. um Motoren anzuhalten
+	 *
+	 * @param delegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+	 */
+	void onFailsafe(const FailsafeDelegate delegate)
+	{
+		m_delegate = delegate;
+	}
+
+	/**
+	 * @brief Verbindet den Failsafe mit einer Ereigniswarteschlange. Ereignisse werden dann
+	 * 		  nur noch angehängt, der Delegat wird nicht aufgerufen.
+	 *
+	 * @param queue Ereigniswarteschlange
+	 * @param device Kennung des Geräts, wird in Ereignissen weitergegeben
+	 */
+	void attach(EventQueue<FailsafeEvent> &queue, const uint8_t device = 0)
+	{
+		m_queue = &queue;
+		m_device = device;
+	}
+
+	/**
+	 * @brief Trennt den Failsafe von der Ereigniswarteschlange
+	 */
+	void detach()
+	{
+		m_queue = nullptr;
+	}
+
+	/**
+	 * @brief Gibt zurück, ob der Failsafe ausgelöst ist
+	 */
+	const bool engaged() const;
+
+	/**
+	 * @brief Gibt das Alter des letzten frischen Datensatzes zum zuletzt abgetasteten
+	 * Zeitpunkt zurück
+	 *
+	 * @return unsigned long Alter in µs, Clock::NEVER vor dem ersten frischen Datensatz
+	 */
+	const unsigned long age() const;
+
+	/**
+	 * @brief Gibt das größte Alter des letzten frischen Datensatzes beim Auslösen zurück,
+	 * d. h. die längste Zeitspanne von den letzten gültigen Werten bis zu neutralen Ausgaben,
+	 * bzw. die größte unbemerkte Lücke (siehe overruns())
+	 *
+	 * @return unsigned long Zeitspanne in µs
+	 */
+	const unsigned long worstLatency() const;
+
+	/**
+	 * @brief Gibt die Anzahl der Auslösungen zurück
+	 */
+	const uint32_t engagements() const;
+
+	/**
+	 * @brief Gibt die Anzahl der Fristüberschreitungen zurück: Auslösungen nach Ablauf der
+	 * Frist sowie Lücken zwischen frischen Datensätzen, die die Frist überschritten, ohne dass
+	 * ausgelöst werden konnte (read() blockierte länger als die Reserve)
+	 */
+	const uint32_t overruns() const;
+
+	/**
+	 * @brief Setzt größtes Alter und Zähler zurück
+	 */
+	void resetStatistics();
+
+	/**
+	 * @brief Gibt den Zeitgeber zurück, er läuft nur, solange der Failsafe nicht ausgelöst ist
+	 */
+	const Deadline &deadline() const
+	{
+		return m_timer;
+	}
+
+private: // private Methoden
+	/**
+	 * @brief Löst den Failsafe aus und meldet das Ereignis
+	 */
+	void engage(const FailsafeEvent::Cause cause);
+
+	/**
+	 * @brief Meldet ein Ereignis, entweder über die Warteschlange oder den Delegaten
+	 */
+	void notify(const FailsafeEvent::Type type, const FailsafeEvent::Cause cause, const unsigned long age);
+
+private: // private Member
+	const unsigned long m_deadline; // zugesicherte Frist in µs
+	const unsigned long m_timeout; // Frist abzüglich Reserve in µs
+	Deadline m_timer; // Ablauf der Frist ab dem letzten frischen Datensatz
+	unsigned long m_lastFresh; // Zeitpunkt des letzten frischen Datensatzes in µs
+	unsigned long m_worst; // größtes Alter beim Auslösen in µs
+	uint32_t m_engagements; // Anzahl der Auslösungen
+	uint32_t m_overruns; // Anzahl der Fristüberschreitungen
+	FailsafeDelegate m_delegate; // Delegat für Ereignisse
+	EventQueue<FailsafeEvent> *m_queue; // Ereigniswarteschlange, nullptr für direkte Aufrufe
+	uint8_t m_device; // Kennung des Geräts
+	bool m_engaged; // Failsafe ausgelöst
+	bool m_fed; // mindestens ein frischer Datensatz seit reset()
+
+};
+
+/**
+ * @brief Policy von NunchukT für den Failsafe, siehe NunchukT::setFailsafe()
+ */
+class FailsafeSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	FailsafeSupport()
+	: m_failsafe{nullptr}
+	{
+
+	}
+
+	/**
+	 * @brief Legt den Failsafe fest, ein zuvor festgelegter wird ersetzt
+	 */
+	void attach(Failsafe &failsafe)
+	{
+		m_failsafe = &failsafe;
+		failsafe.reset();
+	}
+
+	/**
+	 * @return true Failsafe festgelegt
+	 */
+	const bool attached() const
+	{
+		return m_failsafe != nullptr;
+	}
+
+	/**
+	 * @brief Siehe Failsafe::check(), ohne Failsafe false
+	 */
+	const bool check()
+	{
+		return m_failsafe && m_failsafe->check();
+	}
+
+	/**
+	 * @brief Siehe Failsafe::feed()
+	 */
+	void feed()
+	{
+		if (m_failsafe)
+		{
+			m_failsafe->feed();
+		}
+	}
+
+	/**
+	 * @brief Siehe Failsafe::disconnected(), ohne Failsafe false
+	 */
+	const bool disconnected()
+	{
+		return m_failsafe && m_failsafe->disconnected();
+	}
+
+	/**
+	 * @brief Siehe Failsafe::engaged(), ohne Failsafe false
+	 */
+	const bool engaged() const
+	{
+		return m_failsafe && m_failsafe->engaged();
+	}
+
+	/**
+	 * @return const Deadline* Frist des Failsafes, nullptr ohne Failsafe
+	 */
+	const Deadline *deadline() const
+	{
+		return m_failsafe ? &m_failsafe->deadline() : nullptr;
+	}
+
+private: // private Member
+	Failsafe *m_failsafe; // Failsafe, nullptr ohne Überwachung
+
+};
+
+} // namespace communication
+
+#endif // !FAILSAFE_H
@@ -0,0 +1,230 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Gamepad.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	const bool GamepadReport::operator==(const GamepadReport &other) const
+	{
+		return buttons == other.buttons && x == other.x && y == other.y
+			&& rx == other.rx && ry == other.ry && rz == other.rz;
+	}
+
+	Gamepad::Gamepad(const unsigned long keepAlive)
+		: m_sink{},
+		m_report{},
+		m_sent{},
+		m_keepAlive{},
+		m_interval{keepAlive},
+		m_sentCount{0},
+		m_keepAliveCount{0},
+		m_coalesced{0},
+		m_joystickThreshold{1},
+		m_accelerationThreshold{4},
+		m_accelerationShift{2},
+		m_filtered{false},
+		m_valid{false}
+	{
+	}
+
+	void Gamepad::setSink(const ReportSink sink)
+	{
+		m_sink = sink;
+		m_valid = false;
+	}
+
+	void Gamepad::setThresholds(const uint8_t joystick, const uint8_t acceleration)
+	{
+		m_joystickThreshold = (joystick == 0) ? 1 : joystick;
+		m_accelerationThreshold = (acceleration == 0) ? 1 : acceleration;
+	}
+
+	void Gamepad::setFiltered(const bool filtered, const uint8_t extraBits)
+	{
+		m_filtered = filtered;
+		m_accelerationShift = 2 + (filtered ? extraBits : 0);
+	}
+
+	const uint8_t Gamepad::fields() const
+	{
+		return Field::BUTTONS | Field::JOYSTICK | (m_filtered ? Field::FILTERED : Field::ACCELERATION);
+	}
+
+	void Gamepad::update(const Reading &reading)
+	{
+		if (reading.fields & Field::BUTTONS)
+		{
+			m_report.buttons = (reading.buttonC ? 0x01 : 0x00) | (reading.buttonZ ? 0x02 : 0x00);
+		}
+
+		if (reading.fields & Field::JOYSTICK)
+		{
+			m_report.x = track(clamp(reading.joystickX), m_sent.x, m_joystickThreshold);
+			// HID: Y nach unten positiv
+			m_report.y = track(clamp(-reading.joystickY), m_sent.y, m_joystickThreshold);
+		}
+
+		const uint8_t source = m_filtered ? Field::FILTERED : Field::ACCELERATION;
+		if (reading.fields & source)
+		{
+			const int16_t x = m_filtered ? reading.filteredX : reading.accelerationX;
+			const int16_t y = m_filtered ? reading.filteredY : reading.accelerationY;
+			const int16_t z = m_filtered ? reading.filteredZ : reading.accelerationZ;
+
+			// durch Division statt Schieben, damit symmetrisch zur Mitte gerundet wird
+			const int16_t divisor = static_cast<int16_t>(1 << m_accelerationShift);
+			m_report.rx = track(clamp(x / divisor), m_sent.rx, m_accelerationThreshold);
+			m_report.ry = track(clamp(y / divisor), m_sent.ry, m_accelerationThreshold);
+			m_report.rz = track(clamp(z / divisor), m_sent.rz, m_accelerationThreshold);
+		}
+
+		if (!dispatch())
+		{
+			m_coalesced++;
+		}
+	}
+
+	void Gamepad::neutral()
+	{
+		m_report = GamepadReport{};
+		dispatch();
+	}
+
+	void Gamepad::poll()
+	{
+		dispatch();
+	}
+
+	const GamepadReport &Gamepad::report() const
+	{
+		return m_report;
+	}
+
+	const Deadline &Gamepad::deadline() const
+	{
+		return m_keepAlive;
+	}
+
+	const uint32_t Gamepad::sent() const
+	{
+		return m_sentCount;
+	}
+
+	const uint32_t Gamepad::keepAlives() const
+	{
+		return m_keepAliveCount;
+	}
+
+	const uint32_t Gamepad::coalesced() const
+	{
+		return m_coalesced;
+	}
+
+	const int8_t Gamepad::track(const int16_t value, const int8_t sent, const uint8_t threshold)
+	{
+		if (value == 0 || value == AXIS_MAX || value == -AXIS_MAX)
+		{
+			return static_cast<int8_t>(value);
+		}
+
+		const int16_t change = value - sent;
+		return ((change < 0 ? -change : change) >= threshold) ? static_cast<int8_t>(value) : sent;
+	}
+
+	const int16_t Gamepad::clamp(const int16_t value)
+	{
+		return (value > AXIS_MAX) ? AXIS_MAX : ((value < -AXIS_MAX) ? -AXIS_MAX : value);
+	}
+
+	const bool Gamepad::transmit()
+	{
+		if (!m_sink || !m_sink(m_report))
+		{
+			return false;
+		}
+
+		m_sent = m_report;
+		m_valid = true;
+		m_sentCount++;
+
+		if (m_interval != 0)
+		{
+			m_keepAlive.start(m_interval);
+		}
+
+		return true;
+	}
+
+	const bool Gamepad::dispatch()
+	{
+		if (!m_valid || !(m_report == m_sent))
+		{
+			return transmit();
+		}
+
+		if (m_keepAlive.expired() && transmit())
+		{
+			m_keepAliveCount++;
+			return true;
+		}
+
+		return false;
+	}
+
+#if defined(USBCON)
+	namespace
+	{
+		// Report-Deskriptor: Gamepad mit 2 Buttons und 5 Achsen zu je 8 Bit
+		const uint8_t DESCRIPTOR[] PROGMEM{
+			0x05, 0x01, // Usage Page (Generic Desktop)
+			0x09, 0x05, // Usage (Game Pad)
+			0xA1, 0x01, // Collection (Application)
+			0x85, UsbGamepadSink::REPORT_ID, // Report ID
+			0x05, 0x09, //   Usage Page (Button)
+			0x19, 0x01, //   Usage Minimum (1)
+			0x29, 0x02, //   Usage Maximum (2)
+			0x15, 0x00, //   Logical Minimum (0)
+			0x25, 0x01, //   Logical Maximum (1)
+			0x75, 0x01, //   Report Size (1)
+			0x95, 0x02, //   Report Count (2)
+			0x81, 0x02, //   Input (Data, Variable, Absolute)
+			0x75, 0x06, //   Report Size (6)
+			0x95, 0x01, //   Report Count (1)
+			0x81, 0x03, //   Input (Constant), Auffüllen auf ein Byte
+			0x05, 0x01, //   Usage Page (Generic Desktop)
+			0x09, 0x30, //   Usage (X)
+			0x09, 0x31, //   Usage (Y)
+			0x09, 0x33, //   Usage (Rx)
+			0x09, 0x34, //   Usage (Ry)
+			0x09, 0x35, //   Usage (Rz)
+			0x15, 0x81, //   Logical Minimum (-127)
+			0x25, 0x7F, //   Logical Maximum (127)
+			0x75, 0x08, //   Report Size (8)
+			0x95, 0x05, //   Report Count (5)
+			0x81, 0x02, //   Input (Data, Variable, Absolute)
+			0xC0 // End Collection
+		};
+	}
+
+	UsbGamepadSink::UsbGamepadSink()
+		: m_descriptor{DESCRIPTOR, sizeof(DESCRIPTOR)}
+	{
+		HID().AppendDescriptor(&m_descriptor);
+	}
+
+	bool UsbGamepadSink::send(const GamepadReport &report)
+	{
+		return HID().SendReport(REPORT_ID, &report, sizeof(report)) > 0;
+	}
+
+	ReportSink UsbGamepadSink::sink()
+	{
+		return ReportSink::fromMethod<UsbGamepadSink, &UsbGamepadSink::send>(*this);
+	}
+#endif
+} // namespace communication
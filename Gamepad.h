@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Gamepad.h
+ *
+ * @brief  Klassendefinitionen zur Ausgabe dekodierter Datensätze als HID-Gamepad-Report,
+ *         gesendet nur bei Änderung oder nach Ablauf eines Keep-Alive-Intervalls
+ */
+
+#ifndef GAMEPAD_H
+#define GAMEPAD_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Delegate.h"
+#include "Publisher.h"
+
+#if defined(USBCON)
+#include <HID.h>
+#endif
+
+namespace communication
+{
+
+/**
+ * @brief Eingabereport des Gamepads (6 Byte, ohne Report-ID), Aufbau wie im Report-Deskriptor
+ * von UsbGamepadSink. Achsen in [-AXIS_MAX;AXIS_MAX], Y wie bei HID üblich nach unten positiv.
+ */
+struct GamepadReport
+{
+	uint8_t buttons; // Bit 0: Button C, Bit 1: Button Z
+	int8_t x; // Joystick links <-> rechts
+	int8_t y; // Joystick oben <-> unten
+	int8_t rx; // Beschleunigung links <-> rechts
+	int8_t ry; // Beschleunigung vor <-> zurück
+	int8_t rz; // Beschleunigung unten <-> oben
+
+	/**
+	 * @brief Vergleicht zwei Reports
+	 */
+	const bool operator==(const GamepadReport &other) const;
+};
+
+// Empfänger der Reports; gibt false zurück, wenn der Report nicht angenommen wurde (z. B.
+// USB nicht konfiguriert), der Report wird dann mit dem nächsten Aufruf von poll() wiederholt
+using ReportSink = Delegate<bool(const GamepadReport &)>;
+
+/**
+ * @brief Bildet Datensätze auf einen kompakten Gamepad-Report ab: Joystick auf X/Y,
+ * Beschleunigung (auf 8 Bit verkürzt) auf Rx/Ry/Rz, Buttons C und Z auf die Buttons 1 und 2.
+ * Gesendet wird nur, wenn sich der Report ändert oder das Keep-Alive-Intervall seit dem
+ * letzten Senden abgelaufen ist. Je Achsengruppe lässt sich eine Schwelle setzen: kleinere
+ * Änderungen gegenüber dem zuletzt gesendeten Wert (Rauschen des Beschleunigungssensors)
+ * lösen keinen Report aus, Mitte und Anschläge werden immer übernommen.
+ *
+ * Als Abonnent eines Publishers mit den Feldern fields() registrieren, nach dem Abonnieren
+ * je Schleifendurchlauf poll() aufrufen. poll() vergleicht mit Clock, außerhalb von read()
+ * ist daher Clock::tick() aufzurufen.
+ */
+class Gamepad
+{
+
+public: // public static Member
+	// Betrag des größten Achsenwerts im Report
+	static constexpr const int8_t AXIS_MAX{127};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse Gamepad. Ohne Empfänger wird nichts gesendet.
+	 *
+	 * @param keepAlive Zeitspanne in µs, nach der ein unveränderter Report erneut gesendet
+	 * wird, 0 schaltet Keep-Alive ab
+	 */
+	Gamepad(const unsigned long keepAlive = 500000);
+
+	/**
+	 * @brief Setzt den Empfänger der Reports
+	 *
+	 * @param sink Delegat, z. B. UsbGamepadSink::sink() oder eine eigene Funktion zum Testen
+	 */
+	void setSink(const ReportSink sink);
+
+	/**
+	 * @brief Setzt die Schwellen, ab denen eine Achsenänderung einen Report auslöst
+	 *
+	 * @param joystick Schwelle der Joystickachsen in Reporteinheiten, 1 für jede Änderung
+	 * @param acceleration Schwelle der Beschleunigungsachsen in Reporteinheiten (4 Einheiten
+	 * des Sensors je Einheit)
+	 */
+	void setThresholds(const uint8_t joystick, const uint8_t acceleration);
+
+	/**
+	 * @brief Wählt die Quelle der Beschleunigungsachsen
+	 *
+	 * @param filtered true: Ausgabe der Filter-Policy (Field::FILTERED), false: ungefiltert
+	 * @param extraBits zusätzliche Auflösung der Filterausgabe in Bit (z. B.
+	 * DecimationFilter::RESOLUTION_BITS), wird vor der Abbildung auf 8 Bit verworfen
+	 */
+	void setFiltered(const bool filtered, const uint8_t extraBits = 0);
+
+	/**
+	 * @brief Gibt die beim Abonnieren anzugebenden Felder zurück
+	 */
+	const uint8_t fields() const;
+
+	/**
+	 * @brief Übernimmt einen Datensatz und sendet den Report, falls er sich geändert hat
+	 * oder Keep-Alive fällig ist. Nicht enthaltene Felder bleiben unverändert.
+	 *
+	 * @param reading Referenz auf den Datensatz
+	 */
+	void update(const Reading &reading);
+
+	/**
+	 * @brief Setzt alle Achsen auf die Mitte und alle Buttons auf losgelassen, z. B. nach
+	 * einem Verbindungsverlust, und sendet den Report bei Änderung
+	 */
+	void neutral();
+
+	/**
+	 * @brief Wiederholt einen nicht angenommenen Report bzw. sendet den Keep-Alive-Report,
+	 * sobald das Intervall abgelaufen ist
+	 */
+	void poll();
+
+	/**
+	 * @brief Gibt den aktuellen Report zurück
+	 */
+	const GamepadReport &report() const;
+
+	/**
+	 * @brief Gibt den Zeitgeber des Keep-Alive-Intervalls zurück
+	 */
+	const Deadline &deadline() const;
+
+	/**
+	 * @brief Gibt die Anzahl der gesendeten Reports zurück (einschließlich Keep-Alive)
+	 */
+	const uint32_t sent() const;
+
+	/**
+	 * @brief Gibt die Anzahl der wegen Keep-Alive gesendeten Reports zurück
+	 */
+	const uint32_t keepAlives() const;
+
+	/**
+	 * @brief Gibt die Anzahl der übernommenen Datensätze zurück, die keinen Report
+	 * ausgelöst haben
+	 */
+	const uint32_t coalesced() const;
+
+private: // private Methoden
+	/**
+	 * @brief Übernimmt einen Achsenwert, sofern er die Schwelle gegenüber dem zuletzt
+	 * gesendeten Wert erreicht, in der Mitte oder am Anschlag liegt
+	 *
+	 * @param value neuer Wert, bereits auf den Achsenbereich begrenzt
+	 * @param sent zuletzt gesendeter Wert
+	 * @param threshold Schwelle
+	 * @return int8_t Achsenwert des Reports
+	 */
+	static const int8_t track(const int16_t value, const int8_t sent, const uint8_t threshold);
+
+	/**
+	 * @brief Begrenzt einen Wert auf den Achsenbereich
+	 */
+	static const int16_t clamp(const int16_t value);
+
+	/**
+	 * @brief Übergibt den aktuellen Report dem Empfänger
+	 *
+	 * @return true angenommen
+	 */
+	const bool transmit();
+
+	/**
+	 * @brief Sendet bei Änderung, sonst Keep-Alive bei Ablauf des Intervalls
+	 *
+	 * @return true Report gesendet
+	 */
+	const bool dispatch();
+
+private: // private Member
+	ReportSink m_sink; // Empfänger der Reports
+	GamepadReport m_report; // aktueller Report
+	GamepadReport m_sent; // zuletzt angenommener Report
+	Deadline m_keepAlive; // Ablauf des Keep-Alive-Intervalls
+	const unsigned long m_interval; // Keep-Alive-Intervall in µs
+	uint32_t m_sentCount; // gesendete Reports
+	uint32_t m_keepAliveCount; // davon wegen Keep-Alive
+	uint32_t m_coalesced; // Datensätze ohne Report
+	uint8_t m_joystickThreshold; // Schwelle der Joystickachsen
+	uint8_t m_accelerationThreshold; // Schwelle der Beschleunigungsachsen
+	uint8_t m_accelerationShift; // Verkürzung der Beschleunigung auf 8 Bit
+	bool m_filtered; // Beschleunigung aus Field::FILTERED
+	bool m_valid; // m_sent enthält einen angenommenen Report
+
+};
+
+#if defined(USBCON)
+/**
+ * @brief Empfänger, der die Reports über die native USB-Schnittstelle (z. B. Arduino Micro,
+ * Leonardo) als HID-Gamepad sendet. Der Konstruktor meldet den Report-Deskriptor bei der
+ * HID-Bibliothek an; das Objekt muss daher global angelegt werden, damit der Deskriptor vor
+ * der Enumeration durch den Host vorliegt.
+ */
+class UsbGamepadSink
+{
+
+public: // public static Member
+	// Report-ID des Gamepads (1 und 2 belegen Mouse und Keyboard)
+	static constexpr const uint8_t REPORT_ID{3};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse UsbGamepadSink. Meldet den Deskriptor an.
+	 */
+	UsbGamepadSink();
+
+	/**
+	 * @brief Sendet einen Report
+	 *
+	 * @param report Referenz auf den Report
+	 * @return true vom USB-Stack angenommen
+	 */
+	bool send(const GamepadReport &report);
+
+	/**
+	 * @brief Gibt den Delegaten für Gamepad::setSink() zurück
+	 */
+	ReportSink sink();
+
+private: // private Member
+	HIDSubDescriptor m_descriptor; // angemeldeter Report-Deskriptor
+
+};
+#endif
+
+} // namespace communication
+
+#endif // !GAMEPAD_H
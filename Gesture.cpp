@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Gesture.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	namespace
+	{
+		// Zustände ohne Zuordnung zu einem Button
+		constexpr const uint8_t IDLE{0}; // beide Buttons losgelassen
+		constexpr const uint8_t CHORD{1}; // C+Z gemeldet, warten bis beide losgelassen sind
+
+		// Phasen der Zustände je Button, Zustand = FIRST + Button * PHASES + Phase
+		constexpr const uint8_t DOWN{0}; // gedrückt, Haltezeit läuft
+		constexpr const uint8_t HELD{1}; // langer Druck gemeldet, warten auf Loslassen
+		constexpr const uint8_t UP{2}; // losgelassen, Doppelklickfenster läuft
+		constexpr const uint8_t DOWN2{3}; // zweites Mal gedrückt, warten auf Loslassen
+
+		constexpr const uint8_t FIRST{2};
+		constexpr const uint8_t PHASES{4};
+		constexpr const uint8_t STATES{FIRST + 2 * PHASES};
+
+		// Eingaben: Bit 0 Button C, Bit 1 Button Z, Bit 2 Zeitgeber abgelaufen
+		constexpr const uint8_t INPUTS{8};
+
+		/**
+		 * @brief Kodiert einen Tabelleneintrag: Bits [3:0] Folgezustand, Bits [6:4] Art der
+		 * Geste, Bit 7 Button der Geste
+		 */
+		constexpr uint8_t entry(const uint8_t next,
+			const GestureEvent::Type type = GestureEvent::Type::NONE, const uint8_t button = 0)
+		{
+			return next | (static_cast<uint8_t>(type) << 4) | (button << 7);
+		}
+
+		constexpr uint8_t state(const uint8_t button, const uint8_t phase)
+		{
+			return FIRST + button * PHASES + phase;
+		}
+
+		/**
+		 * @brief Regeln des Automaten, für Button C und Z gespiegelt
+		 */
+		constexpr uint8_t transition(const uint8_t current, const uint8_t input)
+		{
+			const bool c = input & 0x01;
+			const bool z = input & 0x02;
+			const bool expired = input & 0x04;
+
+			if (current == IDLE)
+			{
+				return (c && z) ? entry(CHORD, GestureEvent::Type::CHORD)
+					: c ? entry(state(0, DOWN))
+					: z ? entry(state(1, DOWN))
+					: entry(IDLE);
+			}
+
+			if (current == CHORD)
+			{
+				return (c || z) ? entry(CHORD) : entry(IDLE);
+			}
+
+			const uint8_t button = (current - FIRST) / PHASES;
+			const uint8_t phase = (current - FIRST) % PHASES;
+			const bool own = button ? z : c;
+			const bool other = button ? c : z;
+
+			switch (phase)
+			{
+			case DOWN:
+				return other ? entry(CHORD, GestureEvent::Type::CHORD)
+					: !own ? entry(state(button, UP))
+					: expired ? entry(state(button, HELD), GestureEvent::Type::LONG_PRESS, button)
+					: entry(current);
+
+			case HELD:
+				return other ? entry(CHORD, GestureEvent::Type::CHORD)
+					: !own ? entry(IDLE)
+					: entry(current);
+
+			case UP:
+				// der andere Button beendet das Doppelklickfenster vorzeitig
+				return (own && other) ? entry(CHORD, GestureEvent::Type::CHORD)
+					: own ? entry(state(button, DOWN2))
+					: other ? entry(state(1 - button, DOWN), GestureEvent::Type::CLICK, button)
+					: expired ? entry(IDLE, GestureEvent::Type::CLICK, button)
+					: entry(current);
+
+			default: // DOWN2
+				return other ? entry(CHORD, GestureEvent::Type::CHORD)
+					: !own ? entry(IDLE, GestureEvent::Type::DOUBLE_CLICK, button)
+					: entry(current);
+			}
+		}
+
+		struct Table
+		{
+			uint8_t entries[STATES][INPUTS];
+		};
+
+		constexpr Table build()
+		{
+			Table table{};
+			for (uint8_t current = 0; current < STATES; current++)
+			{
+				for (uint8_t input = 0; input < INPUTS; input++)
+				{
+					table.entries[current][input] = transition(current, input);
+				}
+			}
+			return table;
+		}
+
+		// Übergangstabelle, zur Übersetzungszeit erzeugt
+		const Table TABLE PROGMEM = build();
+	}
+
+	GestureRecognizer::GestureRecognizer(const unsigned long longPress, const unsigned long doubleClick)
+		: m_longPress{longPress * 1000UL},
+		m_doubleClick{doubleClick * 1000UL},
+		m_timer{},
+		m_delegate{},
+		m_queue{nullptr},
+		m_state{IDLE},
+		m_device{0}
+	{
+	}
+
+	void GestureRecognizer::update(const bool pressedC, const bool pressedZ)
+	{
+		const uint8_t input = (pressedC ? 0x01 : 0) | (pressedZ ? 0x02 : 0) | (m_timer.expired() ? 0x04 : 0);
+		const uint8_t next = pgm_read_byte(&TABLE.entries[m_state][input]);
+		const uint8_t state = next & 0x0F;
+		const GestureEvent::Type type = static_cast<GestureEvent::Type>((next >> 4) & 0x07);
+
+		// Zeitgeber nur beim Zustandswechsel neu setzen: Haltezeit bzw. Doppelklickfenster
+		if (state != m_state)
+		{
+			const uint8_t phase = (state - FIRST) % PHASES;
+
+			if (state >= FIRST && phase == DOWN)
+			{
+				m_timer.start(m_longPress);
+			}
+			else if (state >= FIRST && phase == UP)
+			{
+				m_timer.start(m_doubleClick);
+			}
+			else
+			{
+				m_timer.stop();
+			}
+			m_state = state;
+		}
+
+		if (type != GestureEvent::Type::NONE)
+		{
+			notify(type, next >> 7);
+		}
+	}
+
+	void GestureRecognizer::reset()
+	{
+		m_state = IDLE;
+		m_timer.stop();
+	}
+
+	void GestureRecognizer::notify(const GestureEvent::Type type, const uint8_t button)
+	{
+		const GestureEvent event{m_device, button, type, Clock::now()};
+
+		if (m_queue)
+		{
+			m_queue->push(event);
+			return;
+		}
+
+		if (m_delegate)
+		{
+			m_delegate(event);
+		}
+	}
+} // namespace communication
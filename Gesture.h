@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Gesture.h
+ *
+ * @brief  Klassendefinition der Gestenerkennung beider Buttons (langer Druck,
+ *         Doppelklick, C+Z gleichzeitig) über eine Übergangstabelle
+ */
+
+#ifndef GESTURE_H
+#define GESTURE_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Delegate.h"
+#include "EventQueue.h"
+
+namespace communication
+{
+
+/**
+ * @brief Erkannte Geste mit Zeitstempel
+ */
+struct GestureEvent
+{
+	/**
+	 * @brief Art der Geste
+	 */
+	enum class Type : uint8_t
+	{
+		NONE, // keine Geste (nur intern)
+		CLICK, // einfacher Klick, gemeldet nach Ablauf des Doppelklickfensters
+		DOUBLE_CLICK, // zweiter Klick innerhalb des Doppelklickfensters, gemeldet beim Loslassen
+		LONG_PRESS, // Button länger als die Haltezeit gedrückt, gemeldet bei Ablauf
+		CHORD // C und Z gleichzeitig gedrückt, gemeldet beim Drücken des zweiten Buttons
+	};
+
+	uint8_t device; // Kennung des Geräts, siehe GestureRecognizer::attach()
+	uint8_t button; // Kennung des Buttons (0 = C, 1 = Z wie ButtonId), bei CHORD 0
+	Type type; // Art der Geste
+	unsigned long timestamp; // Zeitpunkt der Erkennung in µs, siehe Clock::now()
+};
+
+// Delegat, der bei einer erkannten Geste aufgerufen wird
+using GestureDelegate = Delegate<void(const GestureEvent &)>;
+
+/**
+ * @brief Gestenerkennung für beide Buttons gemeinsam. Ein Automat mit zehn Zuständen wird
+ * über eine zur Übersetzungszeit erzeugte Übergangstabelle im Flash betrieben: je Aufruf von
+ * update() ein Tabellenzugriff mit den Gedrücktzuständen und dem Ablauf des Zeitgebers als
+ * Eingabe, unabhängig vom Zustand. Der Zustand umfasst nur den Index des Automaten und einen
+ * Zeitgeber.
+ *
+ * Die Eingaben sollten bereits entprellt sein (z. B. Button::isPressed()). Ein Klick wird
+ * erst gemeldet, wenn kein zweiter Klick mehr folgen kann, also nach Ablauf des
+ * Doppelklickfensters.
+ */
+class GestureRecognizer
+{
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse GestureRecognizer.
+	 *
+	 * @param longPress Haltezeit bis zum langen Druck in ms
+	 * @param doubleClick Doppelklickfenster nach dem Loslassen in ms
+	 */
+	GestureRecognizer(const unsigned long longPress = 600, const unsigned long doubleClick = 250);
+
+	/**
+	 * @brief Übernimmt die Gedrücktzustände zum zuletzt mit Clock::tick() abgetasteten
+	 * 		  Zeitpunkt und meldet ggf. eine Geste
+	 *
+	 * @param pressedC Button C ist gedrückt
+	 * @param pressedZ Button Z ist gedrückt
+	 */
+	void update(const bool pressedC, const bool pressedZ);
+
+	/**
+	 * @brief Registriert einen Delegaten, der bei jeder erkannten Geste aufgerufen wird
+	 *
+	 * @param delegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+	 */
+	void onGesture(const GestureDelegate delegate)
+	{
+		m_delegate = delegate;
+	}
+
+	/**
+	 * @brief Verbindet die Erkennung mit einer Ereigniswarteschlange. Gesten werden dann nur
+	 * 		  noch angehängt, der Delegat wird nicht aufgerufen.
+	 *
+	 * @param queue Ereigniswarteschlange
+	 * @param device Kennung des Geräts, wird in Ereignissen weitergegeben
+	 */
+	void attach(EventQueue<GestureEvent> &queue, const uint8_t device = 0)
+	{
+		m_queue = &queue;
+		m_device = device;
+	}
+
+	/**
+	 * @brief Trennt die Erkennung von der Ereigniswarteschlange
+	 */
+	void detach()
+	{
+		m_queue = nullptr;
+	}
+
+	/**
+	 * @brief Setzt den Automaten zurück, z. B. nach einem Verbindungsverlust
+	 */
+	void reset();
+
+	/**
+	 * @brief Gibt den Zeitgeber für Haltezeit bzw. Doppelklickfenster zurück
+	 */
+	const Deadline &deadline() const
+	{
+		return m_timer;
+	}
+
+private: // private Methoden
+	/**
+	 * @brief Meldet eine Geste, entweder über die Warteschlange oder den Delegaten
+	 */
+	void notify(const GestureEvent::Type type, const uint8_t button);
+
+private: // private Member
+	const unsigned long m_longPress; // Haltezeit in µs
+	const unsigned long m_doubleClick; // Doppelklickfenster in µs
+	Deadline m_timer; // Haltezeit bzw. Doppelklickfenster des aktuellen Zustands
+	GestureDelegate m_delegate; // Delegat für erkannte Gesten
+	EventQueue<GestureEvent> *m_queue; // Ereigniswarteschlange, nullptr für direkte Aufrufe
+	uint8_t m_state; // Zustand des Automaten, Zeile der Übergangstabelle
+	uint8_t m_device; // Kennung des Geräts
+
+};
+
+/**
+ * @brief Policy von NunchukT für die Gestenerkennung, siehe NunchukT::setGestures()
+ */
+class GestureSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	GestureSupport()
+	: m_recognizer{nullptr}
+	{
+
+	}
+
+	/**
+	 * @brief Legt die Erkennung fest und setzt sie zurück, eine zuvor festgelegte wird ersetzt
+	 */
+	void attach(GestureRecognizer &recognizer)
+	{
+		m_recognizer = &recognizer;
+		recognizer.reset();
+	}
+
+	/**
+	 * @return true Erkennung festgelegt
+	 */
+	const bool attached() const
+	{
+		return m_recognizer != nullptr;
+	}
+
+	/**
+	 * @brief Verwirft eine begonnene Geste, z. B. beim Verbindungsaufbau
+	 */
+	void reset()
+	{
+		if (m_recognizer)
+		{
+			m_recognizer->reset();
+		}
+	}
+
+	/**
+	 * @brief Siehe GestureRecognizer::update()
+	 */
+	void update(const bool pressedC, const bool pressedZ)
+	{
+		if (m_recognizer)
+		{
+			m_recognizer->update(pressedC, pressedZ);
+		}
+	}
+
+	/**
+	 * @return const Deadline* Haltezeit bzw. Doppelklickfenster, nullptr ohne Erkennung
+	 */
+	const Deadline *deadline() const
+	{
+		return m_recognizer ? &m_recognizer->deadline() : nullptr;
+	}
+
+private: // private Member
+	GestureRecognizer *m_recognizer; // Erkennung, nullptr ohne Gesten
+
+};
+
+} // namespace communication
+
+#endif // !GESTURE_H
@@ -0,0 +1,33 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "I2CMultiplexer.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	I2CMultiplexer::I2CMultiplexer(const uint8_t address)
+		: m_address{address},
+		m_channel{NO_CHANNEL},
+		m_switches{0}
+	{
+	}
+
+	void I2CMultiplexer::invalidate()
+	{
+		m_channel = NO_CHANNEL;
+	}
+
+	const uint8_t I2CMultiplexer::channel() const
+	{
+		return m_channel;
+	}
+
+	const uint32_t I2CMultiplexer::switches() const
+	{
+		return m_switches;
+	}
+} // namespace communication
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   I2CMultiplexer.h
+ *
+ * @brief  Klassendefinition eines I2C-Multiplexers nach Art des TCA9548A, über den mehrere
+ *         Nunchuks mit derselben Adresse an einem Bus betrieben werden können
+ */
+
+#ifndef I2C_MULTIPLEXER_H
+#define I2C_MULTIPLEXER_H
+
+#include <Arduino.h>
+
+#include "WireBus.h"
+
+namespace communication
+{
+
+class I2CMultiplexer
+{
+
+public: // public static Member
+	// Standardadresse des Multiplexers (A0..A2 auf GND)
+	static constexpr const uint8_t ADDR_DEFAULT{0x70};
+
+	// Anzahl der Kanäle
+	static constexpr const uint8_t CHANNELS{8};
+
+	// kein Kanal ausgewählt bzw. Auswahl unbekannt
+	static constexpr const uint8_t NO_CHANNEL{0xFF};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse I2CMultiplexer.
+	 *
+	 * @param address I2C-Adresse des Multiplexers [0x70;0x77]
+	 */
+	I2CMultiplexer(const uint8_t address = ADDR_DEFAULT);
+
+	/**
+	 * @brief Schaltet den angegebenen Kanal auf den Bus. Ist der Kanal bereits ausgewählt,
+	 * 		  entfällt die Übertragung.
+	 *
+	 * @tparam Bus Bus-Policy, über die der Multiplexer erreichbar ist
+	 * @param bus Bus, an dem der Multiplexer hängt
+	 * @param channel Kanal [0;CHANNELS)
+	 * @return true Kanal ist ausgewählt
+	 * @return false ungültiger Kanal oder Übertragungsfehler
+	 */
+	template<class Bus>
+	const bool select(Bus &bus, const uint8_t channel)
+	{
+		if (channel >= CHANNELS)
+		{
+			return false;
+		}
+
+		// Kanal bereits verbunden, keine Übertragung notwendig
+		if (channel == m_channel)
+		{
+			return true;
+		}
+
+		if (!transmit(bus, static_cast<uint8_t>(1 << channel)))
+		{
+			return false;
+		}
+
+		m_channel = channel;
+		return true;
+	}
+
+	/**
+	 * @brief Schaltet den angegebenen Kanal auf den Hardware-I2C-Bus, siehe select(Bus&, uint8_t)
+	 */
+	const bool select(const uint8_t channel)
+	{
+		WireBus bus;
+		return select(bus, channel);
+	}
+
+	/**
+	 * @brief Trennt alle Kanäle vom Bus
+	 *
+	 * @tparam Bus Bus-Policy, über die der Multiplexer erreichbar ist
+	 * @param bus Bus, an dem der Multiplexer hängt
+	 * @return true Übertragung erfolgreich
+	 * @return false Übertragungsfehler
+	 */
+	template<class Bus>
+	const bool deselect(Bus &bus)
+	{
+		if (!transmit(bus, 0x00))
+		{
+			return false;
+		}
+
+		m_channel = NO_CHANNEL;
+		return true;
+	}
+
+	/**
+	 * @brief Trennt alle Kanäle vom Hardware-I2C-Bus, siehe deselect(Bus&)
+	 */
+	const bool deselect()
+	{
+		WireBus bus;
+		return deselect(bus);
+	}
+
+	/**
+	 * @brief Verwirft die zwischengespeicherte Kanalauswahl, z. B. nach einem Reset des
+	 * 		  Multiplexers. Die nächste Auswahl wird in jedem Fall übertragen.
+	 */
+	void invalidate();
+
+	/**
+	 * @brief Gibt den aktuell ausgewählten Kanal zurück
+	 *
+	 * @return uint8_t Kanal, NO_CHANNEL falls keiner ausgewählt bzw. unbekannt
+	 */
+	const uint8_t channel() const;
+
+	/**
+	 * @brief Gibt die Anzahl der tatsächlich übertragenen Kanalwechsel zurück
+	 *
+	 * @return uint32_t Anzahl der Kanalwechsel
+	 */
+	const uint32_t switches() const;
+
+private: // private Methoden
+	/**
+	 * @brief Überträgt das Steuerregister des Multiplexers
+	 *
+	 * @param bus Bus, an dem der Multiplexer hängt
+	 * @param mask Bitmaske der zu verbindenden Kanäle
+	 * @return true Übertragung erfolgreich
+	 * @return false Übertragungsfehler
+	 */
+	template<class Bus>
+	const bool transmit(Bus &bus, const uint8_t mask)
+	{
+		bus.beginTransmission(m_address);
+		bus.write(mask);
+
+		m_switches++;
+
+		if (bus.endTransmission(true) != 0)
+		{
+			// Zustand des Multiplexers unbekannt
+			m_channel = NO_CHANNEL;
+			return false;
+		}
+
+		return true;
+	}
+
+private: // private Member
+	const uint8_t m_address; // I2C-Adresse des Multiplexers
+	uint8_t m_channel; // aktuell ausgewählter Kanal
+	uint32_t m_switches; // Anzahl übertragener Kanalwechsel
+
+};
+
+/**
+ * @brief Policy von NunchukT für den Betrieb hinter einem Multiplexer, siehe
+ * 		  NunchukT::setMultiplexer()
+ */
+class MultiplexerSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	MultiplexerSupport()
+	: m_mux{nullptr},
+	  m_channel{I2CMultiplexer::NO_CHANNEL}
+	{
+
+	}
+
+	/**
+	 * @brief Legt Multiplexer und Kanal des Geräts fest
+	 */
+	void attach(I2CMultiplexer &mux, const uint8_t channel)
+	{
+		m_mux = &mux;
+		m_channel = channel;
+	}
+
+	/**
+	 * @brief Schaltet den Kanal des Geräts auf den Bus, ohne Multiplexer ohne Übertragung
+	 *
+	 * @return false ungültiger Kanal oder Übertragungsfehler
+	 */
+	template<class Bus>
+	const bool select(Bus &bus)
+	{
+		return !m_mux || m_mux->select(bus, m_channel);
+	}
+
+private: // private Member
+	I2CMultiplexer *m_mux; // Multiplexer, nullptr bei direktem Anschluss
+	uint8_t m_channel; // Kanal des Geräts am Multiplexer
+
+};
+
+} // namespace communication
+
+#endif // !I2C_MULTIPLEXER_H
@@ -141,8 +141,9 @@ class MovingAverage
 		 */
 		void shift(T next)
 		{
+			/* ältestes Element wird beim Schreiben überschrieben */
+			m_cumsum += next - m_data.back();
 			m_data.write(next);
-			m_cumsum += m_data.front() - m_data.back();
 		}
 
 		/**
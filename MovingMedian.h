@@ -0,0 +1,199 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef MOVING_MEDIAN_H
+#define MOVING_MEDIAN_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Klassen-Template des gleitenden Medians über die letzten Width Werte von einem oder
+ * mehreren Kanälen. Je Kanal wird neben der Reihenfolge des Eintreffens ein sortiertes Fenster
+ * geführt: der älteste Wert wird per binärer Suche gefunden und der neue Wert durch Verschieben
+ * der dazwischenliegenden Elemente eingefügt, ohne das Fenster neu zu sortieren. Alle Kanäle
+ * teilen sich die Position im Ringpuffer.
+ *
+ * Anders als der gleitende Mittelwert verteilt der Median einzelne Ausreißer nicht über das
+ * Fenster, solange weniger als die Hälfte der Werte betroffen ist.
+ *
+ * @tparam T (Ganzzahl-)Datentyp der Elemente
+ * @tparam Width Anzahl der Elemente je Kanal, ungerade (bei gerader Anzahl unterer Median)
+ * @tparam Channels Anzahl der Kanäle
+ */
+template<
+	class T,
+	size_t Width,
+	size_t Channels = 1
+>
+class MovingMedian
+{
+	static_assert(Width > 0 && Width <= 255, "Width muss in [1;255] liegen");
+	static_assert(Channels > 0, "mindestens ein Kanal");
+
+	public: // public static Member
+
+		// Position des Medians im sortierten Fenster
+		static constexpr const size_t MIDDLE{(Width - 1) / 2};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der Klasse MovingMedian. Der erste Wert je Kanal
+		 * füllt das gesamte Fenster.
+		 */
+		MovingMedian()
+		: m_data{},
+		  m_sorted{},
+		  m_index{0},
+		  m_primed{false}
+		{
+
+		}
+
+		/**
+		 * @brief Fügt je Kanal einen neuen Wert hinzu und entfernt den ältesten
+		 *
+		 * @param values Zeiger auf Channels Werte
+		 */
+		void shift(const T *values)
+		{
+			if (!m_primed)
+			{
+				prime(values);
+				return;
+			}
+
+			for (size_t channel = 0; channel < Channels; channel++)
+			{
+				replace(m_sorted[channel], m_data[m_index][channel], values[channel]);
+				m_data[m_index][channel] = values[channel];
+			}
+
+			m_index = (m_index + 1) % Width;
+		}
+
+		/**
+		 * @brief Fügt einen neuen Wert hinzu (ein Kanal)
+		 *
+		 * @param next neu hinzuzufügender Wert
+		 */
+		void shift(const T next)
+		{
+			static_assert(Channels == 1, "shift(T) nur für einen Kanal");
+			shift(&next);
+		}
+
+		/**
+		 * @brief Gibt den Median eines Kanals zurück
+		 *
+		 * @param channel Kanal
+		 */
+		const T median(const size_t channel = 0) const
+		{
+			return m_sorted[channel][MIDDLE];
+		}
+
+		/**
+		 * @brief Gibt die mittlere absolute Abweichung vom Median (MAD) eines Kanals zurück.
+		 * Die Abweichungen links und rechts des Medians sind im sortierten Fenster bereits
+		 * aufsteigend geordnet und werden bis zur mittleren Position zusammengeführt, O(Width).
+		 *
+		 * @param channel Kanal
+		 */
+		const T deviation(const size_t channel = 0) const
+		{
+			const T *sorted = m_sorted[channel];
+			const int32_t middle = sorted[MIDDLE];
+			size_t left = MIDDLE;
+			size_t right = MIDDLE;
+			int32_t result = 0;
+
+			for (size_t k = 0; k <= MIDDLE; k++)
+			{
+				const bool takeLeft = (left > 0)
+					&& (right >= Width || (middle - sorted[left - 1]) <= (sorted[right] - middle));
+
+				result = takeLeft ? middle - sorted[--left] : sorted[right++] - middle;
+			}
+
+			return static_cast<T>(result);
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Füllt das Fenster jedes Kanals mit dem ersten Wert
+		 */
+		void prime(const T *values)
+		{
+			for (size_t i = 0; i < Width; i++)
+			{
+				for (size_t channel = 0; channel < Channels; channel++)
+				{
+					m_data[i][channel] = values[channel];
+					m_sorted[channel][i] = values[channel];
+				}
+			}
+			m_primed = true;
+		}
+
+		/**
+		 * @brief Ersetzt einen Wert im sortierten Fenster durch einen neuen
+		 *
+		 * @param sorted sortiertes Fenster eines Kanals
+		 * @param old zu entfernender Wert, ist im Fenster enthalten
+		 * @param value einzufügender Wert
+		 */
+		static void replace(T *sorted, const T old, const T value)
+		{
+			// binäre Suche nach dem ältesten Wert
+			size_t low = 0;
+			size_t high = Width - 1;
+			while (low < high)
+			{
+				const size_t middle = (low + high) / 2;
+				if (sorted[middle] < old)
+				{
+					low = middle + 1;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+
+			// Lücke zur Einfügeposition des neuen Werts verschieben
+			size_t position = low;
+			if (value > old)
+			{
+				while (position + 1 < Width && sorted[position + 1] < value)
+				{
+					sorted[position] = sorted[position + 1];
+					position++;
+				}
+			}
+			else
+			{
+				while (position > 0 && sorted[position - 1] > value)
+				{
+					sorted[position] = sorted[position - 1];
+					position--;
+				}
+			}
+
+			sorted[position] = value;
+		}
+
+	private: // private Member
+		T m_data[Width][Channels]; // Werte in der Reihenfolge des Eintreffens
+		T m_sorted[Channels][Width]; // sortiertes Fenster je Kanal
+		uint8_t m_index; // Position des ältesten Werts
+		bool m_primed; // erster Wert übernommen
+};
+
+} // namespace communication
+
+#endif // !MOVING_MEDIAN_H
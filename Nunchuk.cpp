@@ -32,7 +32,6 @@
 
 #include "Nunchuk.h"
 
-#include <Wire.h>
 
 namespace communication
 {
@@ -77,326 +76,124 @@ void serialerror(const char* annotation, const State code)
   serialwrite("error", annotation);
 }
 
-    Nunchuk::Nunchuk(const unsigned long buttonTimeout,
-      const unsigned long cycletime,
-      const ClockMode mode)
-        : m_pinLevelshifter { 0xFF },
-        m_raw { 0x00 },
-        m_state{ State::BEGIN },
-        m_cycletime { cycletime },
-        m_lastFetch { millis() },
-        m_buttonC {this, buttonTimeout},
-        m_buttonZ {this, buttonTimeout}
-    {
-      Wire.setClock(static_cast<uint32_t>(mode));
-    }
-
-    Nunchuk::Nunchuk(const uint8_t lvlshft,
-      const unsigned long buttonTimeout,
-      const unsigned long cycletime,
-      const ClockMode mode)
-        : Nunchuk(lvlshft, buttonTimeout, buttonTimeout, cycletime, mode)
-    {}
-
-    Nunchuk::Nunchuk(const uint8_t lvlshft,
-      const unsigned long cTimeout, const unsigned long zTimeout,
-      const unsigned long cycletime,
-      const ClockMode mode)
-        :  m_pinLevelshifter { lvlshft },
-        m_raw { 0x00 },
-        m_state{ State::BEGIN },
-        m_cycletime { cycletime },
-        m_lastFetch { millis() },
-        m_buttonC {this, cTimeout},
-        m_buttonZ {this, zTimeout}
-    {
-      Wire.setClock(static_cast<uint32_t>(mode));
-
-      pinMode(m_pinLevelshifter, OUTPUT);
-      digitalWrite(m_pinLevelshifter, LOW);
-    }
-
-    Nunchuk::~Nunchuk()
-    {
-      Wire.end();
-    }
-
-    const bool Nunchuk::isConnected() const
-    {
-        return m_state == State::CONNECTED;
-    }
-
-    const State Nunchuk::getState() const
-    {
-      return m_state;
-    }
-
-    State Nunchuk::begin()
-    {      
-      serialverbose("Nunchuk-Initialisierung gestartet.");
-
-      // Initialisierungssequenz
-      Wire.begin();
-      enable();
-
-      Wire.beginTransmission(Control::ADDR_NUNCHUK);
-      // erstes Initialisierungsregister
-      Wire.write(static_cast<uint8_t>(0xF0));
-      // auf ersten Initialisierungswert setzen
-      Wire.write(static_cast<uint8_t>(0x55));
-      Wire.endTransmission(true);
-
-      delay(1);
-
-      Wire.beginTransmission(Control::ADDR_NUNCHUK);
-      // zweites Initialisierungsregister
-      Wire.write(static_cast<uint8_t>(0xFB));
-      // auf zweiten Initialisierungswert setzen
-      Wire.write(static_cast<uint8_t>(0x00));
-
-      switch (Wire.endTransmission(true))
-      {
-      case WireReturnCode::SUCCESS:
-        serialinfo("Nunchuk-Initalisierung erfolgreich.");
-        m_state = State::CONNECTED;
-        break;
-
-      case WireReturnCode::DATA_TOO_LONG:
-        serialerror("Übertragungsfehler: Zu viele Daten für Übertragungspuffer.", State::BAD_VALUE);
-        m_state = State::BAD_VALUE;
-        [[fallthrough]];
-
-      case WireReturnCode::NACK_ON_ADDR:
-        serialerror("Übertragungsfehler: NACK erhalten bei Übertragung der Adresse.", State::BAD_VALUE);
-        m_state = State::BAD_VALUE;
-        [[fallthrough]];
-        
-      case WireReturnCode::NACK_ON_DATA:
-        serialerror("Übertragungsfehler: NACK erhalten bei Übertragung der Daten.", State::BAD_VALUE);
-        m_state = State::BAD_VALUE;
-        [[fallthrough]];
-
-      case WireReturnCode::OTHER:
-        serialerror("Übertragungsfehler: Allgemeiner Fehler.", State::ERROR_OCCURED);
-        m_state = State::ERROR_OCCURED;
-        [[fallthrough]];
-
-      case WireReturnCode::TIMEOUT:
-        serialerror("Übertragungsfehler: Nunchuk braucht zu lange zum Antworten.", State::TIMEOUT);
-        m_state = State::TIMEOUT;
-        [[fallthrough]];
-
-      default:
-        m_state = State::NOT_CONNECTED;
-        break;
-      }
-      disable();
-      return m_state;
-    }
-
-    State Nunchuk::read()
-    {
-      switch (m_state)
-      {
-      case State::CONNECTED:
-        // erst lesen, wenn die Zykluszeit vorbei ist
-        if ((millis() - m_lastFetch) < m_cycletime)
-        {
-          return State::NO_DATA_AVAILABLE;
-        }
-
-        m_lastFetch = millis();
-
-        // Rohdaten vom Gerät anfordern
-        enable();
-
-        //delayMicroseconds(1);
-
-        if (Wire.requestFrom(Control::ADDR_NUNCHUK, Control::LEN_RAW_DATA) != Control::LEN_RAW_DATA)
-        {
-  
-            // falls Fehler bei der Kommunikation, das Gerät als getrennt markieren und mit
-            // Fehler zurückkehren
-            m_state = State::NOT_CONNECTED;
-            serialerror("Übertragung fehlgeschlagen.", m_state);
-        }
-
-        if constexpr (debugmode > 1)
-        {
-          auto msg = String("Anzahl der verfügbaren Bytes: ");
-          msg += String(Wire.available());
-          serialverbose(msg.c_str());
-        }
-
-        // empfangene Daten auslesen
-        for (uint8_t i = 0; (i < Control::LEN_RAW_DATA) && Wire.available(); i++)
+    namespace Encryption
+    {
+        const uint8_t DECRYPT_TABLE[256] PROGMEM = {
+        0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27, 0x36, 0x35, 0x34, 0x33, 0x32, 0x31, 0x30, 0x2F,
+        0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1F,
+        0x4E, 0x4D, 0x4C, 0x4B, 0x4A, 0x49, 0x48, 0x47, 0x56, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x4F,
+        0x3E, 0x3D, 0x3C, 0x3B, 0x3A, 0x39, 0x38, 0x37, 0x46, 0x45, 0x44, 0x43, 0x42, 0x41, 0x40, 0x3F,
+        0x6E, 0x6D, 0x6C, 0x6B, 0x6A, 0x69, 0x68, 0x67, 0x76, 0x75, 0x74, 0x73, 0x72, 0x71, 0x70, 0x6F,
+        0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x59, 0x58, 0x57, 0x66, 0x65, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F,
+        0x8E, 0x8D, 0x8C, 0x8B, 0x8A, 0x89, 0x88, 0x87, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x8F,
+        0x7E, 0x7D, 0x7C, 0x7B, 0x7A, 0x79, 0x78, 0x77, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7F,
+        0xAE, 0xAD, 0xAC, 0xAB, 0xAA, 0xA9, 0xA8, 0xA7, 0xB6, 0xB5, 0xB4, 0xB3, 0xB2, 0xB1, 0xB0, 0xAF,
+        0x9E, 0x9D, 0x9C, 0x9B, 0x9A, 0x99, 0x98, 0x97, 0xA6, 0xA5, 0xA4, 0xA3, 0xA2, 0xA1, 0xA0, 0x9F,
+        0xCE, 0xCD, 0xCC, 0xCB, 0xCA, 0xC9, 0xC8, 0xC7, 0xD6, 0xD5, 0xD4, 0xD3, 0xD2, 0xD1, 0xD0, 0xCF,
+        0xBE, 0xBD, 0xBC, 0xBB, 0xBA, 0xB9, 0xB8, 0xB7, 0xC6, 0xC5, 0xC4, 0xC3, 0xC2, 0xC1, 0xC0, 0xBF,
+        0xEE, 0xED, 0xEC, 0xEB, 0xEA, 0xE9, 0xE8, 0xE7, 0xF6, 0xF5, 0xF4, 0xF3, 0xF2, 0xF1, 0xF0, 0xEF,
+        0xDE, 0xDD, 0xDC, 0xDB, 0xDA, 0xD9, 0xD8, 0xD7, 0xE6, 0xE5, 0xE4, 0xE3, 0xE2, 0xE1, 0xE0, 0xDF,
+        0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08, 0x07, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F,
+        0xFE, 0xFD, 0xFC, 0xFB, 0xFA, 0xF9, 0xF8, 0xF7, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0xFF
+        };
+    }
+
+    const bool Frame::isPlausible() const
+    {
+        bool allZero = true;
+        bool allSet = true;
+
+        for (uint8_t i = 0; i < Control::LEN_RAW_DATA; i++)
         {
-            m_raw[i] = Wire.read();
+            allZero = allZero && (raw[i] == 0x00);
+            allSet = allSet && (raw[i] == 0xFF);
         }
 
-        Wire.beginTransmission(Control::ADDR_NUNCHUK);
-        Wire.write(Control::REG_RAW_DATA);
-        Wire.endTransmission(true);
-
-        disable();
-
-        m_buttonC.exec();
-        m_buttonZ.exec();
-        
-        // ggf. Rohdaten ausgeben
-        if constexpr (debugmode > 0)
-        {
-          serialinfo("Rohdaten:");
-            for (uint8_t i = 0; i < Control::LEN_RAW_DATA; i++)
-            {
-              Serial.print(m_raw[i], HEX);
-              Serial.print(" ");
-            }
-            Serial.println();
-        }
-        break;
-
-      case State::NOT_CONNECTED:
-        // Falls das Gerät nicht verbunden/initialisiert ist zweimal versuchen, sonst mit Fehler
-        // zurückkehren
-        for (int i = 1; i <= 3; i++)
-        {
-          begin();
-          
-          if (m_state == State::CONNECTED)
-          {
-            serialinfo("Nunchuk bereit zur Kommunikation");
-            break;
-          }
-          else
-          {
-            serialerror("Verbindungsaufbau nach 3 Versuchen fehlgeschlagen.", m_state);
-          }
-        }
-      
-      default:
-        m_state = State::ERROR_OCCURED;
-        break;
-      }
-
-      return m_state;
+        return !allZero && !allSet;
     }
 
-    const bool Nunchuk::pressedC() const
+    const bool Frame::operator==(const Frame &other) const
     {
-      return m_buttonC.isPressed();
+        return memcmp(raw, other.raw, Control::LEN_RAW_DATA) == 0;
     }
 
-    const bool Nunchuk::pressedZ() const
+    const Frame Frame::neutral(const uint8_t centerX, const uint8_t centerY)
     {
-      return m_buttonZ.isPressed();
+        // Bits [1:0] der Beschleunigung 0, Buttons sind low-aktiv
+        return Frame{{centerX, centerY,
+            static_cast<uint8_t>(Acceleration::X_NULL >> 2),
+            static_cast<uint8_t>(Acceleration::Y_NULL >> 2),
+            static_cast<uint8_t>(Acceleration::Z_NULL >> 2),
+            static_cast<uint8_t>(Bitmask::BUTTON_Z_STATE | Bitmask::BUTTON_C_STATE)}};
     }
 
-    const bool Nunchuk::decodeButtonZ() const
+    const bool Frame::decodeButtonZ() const
     {
-        return !static_cast<bool>((m_raw[5] & Bitmask::BUTTON_Z_STATE) >> 0);
+        return !static_cast<bool>((raw[5] & Bitmask::BUTTON_Z_STATE) >> 0);
     }
 
-    const bool Nunchuk::decodeButtonC() const
+    const bool Frame::decodeButtonC() const
     {
-        return !static_cast<bool>((m_raw[5] & Bitmask::BUTTON_C_STATE) >> 1);
+        return !static_cast<bool>((raw[5] & Bitmask::BUTTON_C_STATE) >> 1);
     }
 
-    const int16_t Nunchuk::decodeAccelerationX() const
+    const int16_t Frame::decodeAccelerationX() const
     {
-        return static_cast<int16_t>((m_raw[2] << 2) | (static_cast<uint16_t>((m_raw[5] >> 2) & Bitmask::ACC_X_BIT_0_1))
-            - Acceleration::X_NULL);
+        // Bits [9:2] aus raw[2], Bits [1:0] aus dem zusammengesetzten Register
+        const uint16_t value = (static_cast<uint16_t>(raw[2]) << 2)
+            | ((raw[5] & Bitmask::ACC_X_BIT_0_1) >> 2);
+        return static_cast<int16_t>(value) - Acceleration::X_NULL;
     }
 
-    const int16_t Nunchuk::decodeAccelerationY() const
+    const int16_t Frame::decodeAccelerationY() const
     {
-        return static_cast<int16_t>((m_raw[3] << 2) | (static_cast<uint16_t>((m_raw[5] >> 4) & Bitmask::ACC_Y_BIT_0_1))
-            - Acceleration::Y_NULL);
+        // Bits [9:2] aus raw[3], Bits [1:0] aus dem zusammengesetzten Register
+        const uint16_t value = (static_cast<uint16_t>(raw[3]) << 2)
+            | ((raw[5] & Bitmask::ACC_Y_BIT_0_1) >> 4);
+        return static_cast<int16_t>(value) - Acceleration::Y_NULL;
     }
 
-    const int16_t Nunchuk::decodeAccelerationZ() const
+    const int16_t Frame::decodeAccelerationZ() const
     {
-        return static_cast<int16_t>((m_raw[4] << 2) | (static_cast<uint16_t>((m_raw[5]>> 6) & Bitmask::ACC_Z_BIT_0_1) )
-            - Acceleration::Z_NULL);
+        // Bits [9:2] aus raw[4], Bits [1:0] aus dem zusammengesetzten Register
+        const uint16_t value = (static_cast<uint16_t>(raw[4]) << 2)
+            | ((raw[5] & Bitmask::ACC_Z_BIT_0_1) >> 6);
+        return static_cast<int16_t>(value) - Acceleration::Z_NULL;
     }
 
-    const int16_t Nunchuk::decodeJoystickX() const
+    const int16_t Frame::decodeJoystickX() const
     {
-        return m_raw[0] - Joystick::X_NULL;
+        return raw[0] - Joystick::X_NULL;
     }
 
-    const int16_t Nunchuk::decodeJoystickY() const
+    const int16_t Frame::decodeJoystickY() const
     {
-        return m_raw[1] - Joystick::Y_NULL;
+        return raw[1] - Joystick::Y_NULL;
     }
 
-    void Nunchuk::print()
+    const int16_t Frame::decodeJoystickX(const uint8_t center) const
     {
-      if (!isConnected())
-      {
-        m_state = State::NO_DATA_AVAILABLE;
-        serialerror("Es liegen keine neuen Sensorendaten vor.", m_state);
-        return;
-      }
-      
-      Serial.print("\nDaten (dezimale Werte)\n\n");
-      Serial.print("Joystick:\t\t\tX = ");
-      Serial.print(decodeJoystickX(), DEC);
-      Serial.print("\tY = ");
-      Serial.print(decodeJoystickY(), DEC);
-      Serial.println();
-      Serial.print("Beschleunigung:\tX = ");
-      Serial.print(decodeAccelerationX(), DEC);
-      Serial.print("\tY = ");
-      Serial.print(decodeAccelerationY(), DEC);
-      Serial.print("\tZ = ");
-      Serial.print(decodeAccelerationZ(), DEC);
-      Serial.println();
-      Serial.print("Buttons:\n\tC = ");
-      Serial.print(decodeButtonC() ? "gedrückt" : "nicht gedrückt");
-      Serial.println();
-      Serial.print("\tZ = ");
-      Serial.print(decodeButtonZ() ? "gedrückt" : "nicht gedrückt");
-      Serial.println();
+        return raw[0] - center;
     }
 
-    void Nunchuk::enable() const
+    const int16_t Frame::decodeJoystickY(const uint8_t center) const
     {
-      if (m_pinLevelshifter == 0xFF)
-        return;
-
-      serialverbose("Pegelwandler aktiviert.");
-      digitalWrite(m_pinLevelshifter, HIGH);
-      delayMicroseconds(500);
+        return raw[1] - center;
     }
 
-    void Nunchuk::disable() const
-    {
-      if (m_pinLevelshifter == 0xFF)
-        return;
-        
-      serialverbose("Pegelwandler deaktiviert.");
-      digitalWrite(m_pinLevelshifter, LOW);
-      delayMicroseconds(500);
-    }
+    // Instanz der Standardkonfiguration, siehe Nunchuk.h
+    template class NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer>;
 
-  Nunchuk::ButtonC::ButtonC(const Nunchuk *dev, const unsigned long duration)
-    : Button::Button(duration),
-    m_device(dev)
-  {}
+    // die minimale Konfiguration belegt nur Datensatz, Zeitgeber des Verbindungsaufbaus,
+    // Zeitpunkt des Registerzeigers und die beiden Zähler; höchstens 28 Byte für Zustand,
+    // Mittenwerte, Flags, leere Policies und Ausrichtung (80 Byte auf x86-64)
+    static_assert(sizeof(NunchukT<WireBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>)
+        <= sizeof(SeqLock<Frame>) + sizeof(Deadline) + sizeof(unsigned long) + 2 * sizeof(uint32_t) + 28,
+        "Zustand einer Erweiterung liegt außerhalb ihrer Policy");
 
-  Nunchuk::ButtonZ::ButtonZ(const Nunchuk *dev, const unsigned long duration)
-    : Button::Button(duration),
-    m_device(dev)
-  {}
-
-  const Button::State Nunchuk::ButtonC::getState() const
-	{
-		return m_device->decodeButtonC() ? State::PRESSED : State::RELEASED;
-	}
-
-	const Button::State Nunchuk::ButtonZ::getState() const
-	{
-		return m_device->decodeButtonZ() ? State::PRESSED : State::RELEASED;
-	}
-}
\ No newline at end of file
+    // die Standardkonfiguration enthält keine Erweiterungen, hinzu kommen nur Entprellung,
+    // Zykluszeit und Pegelwandler samt Ausrichtung (312 Byte auf x86-64)
+    static_assert(sizeof(Nunchuk) <= sizeof(NunchukT<WireBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>)
+        + sizeof(ButtonDebounce) + sizeof(CycleTimer) + 2 * sizeof(unsigned long),
+        "Standardkonfiguration enthält Zustand einer Erweiterung");
+}
@@ -35,6 +35,12 @@
 #include <Arduino.h>
 
 #include "Button.h"
+#include "BusScheduler.h"
+#include "Clock.h"
+#include "NunchukPolicies.h"
+#include "SeqLock.h"
+#include "Trace.h"
+#include "WireBus.h"
 
 namespace communication
 {
@@ -108,6 +114,18 @@ namespace communication
         constexpr JoystickConstant Y_NULL{0x7E};
     };
 
+    // Kennungen der Buttons in Ereignissen
+    namespace ButtonId
+    {
+        using ButtonIdConstant = const uint8_t;
+
+        // Kennung des Buttons C
+        constexpr ButtonIdConstant C{0};
+
+        // Kennung des Buttons Z
+        constexpr ButtonIdConstant Z{1};
+    };
+
     // Neutralwert der Gyrosensoren in angebener Richtung
     namespace Acceleration
     {
@@ -143,11 +161,73 @@ namespace communication
         // Registeradresse der Kalibrierungsdaten
         constexpr ControlConstant REG_CAL_DATA{0x20};
 
+        // Position des Joystick-Mittenwerts (links <-> rechts) in den Kalibrierungsdaten
+        constexpr ControlConstant CAL_JOYSTICK_X_NULL{10};
+
+        // Position des Joystick-Mittenwerts (oben <-> unten) in den Kalibrierungsdaten
+        constexpr ControlConstant CAL_JOYSTICK_Y_NULL{13};
+
         // Registeradresse der Nunchuk-ID
         constexpr ControlConstant REG_ID{0xFA};
 
         // Registeradresse zum Überprüfen des Verschlüsselungsstatus
         constexpr ControlConstant REG_IS_ENCR{0};
+
+        // Länge der Nunchuk-ID
+        constexpr ControlConstant LEN_ID{6};
+
+        // ID eines initialisierten, unverschlüsselten Nunchuks
+        constexpr ControlConstant ID_NUNCHUK[LEN_ID]{0x00, 0x00, 0xA4, 0x20, 0x00, 0x00};
+
+        // Wartezeit zwischen Setzen des Registerzeigers und Auslesen in µs
+        constexpr ControlConstant DELAY_REGISTER_US{200};
+
+        // Abstand zwischen Setzen des Registerzeigers und Auslesen, der für jedes Gerät sicher
+        // ist; Referenz beim Messen des Mindestabstands in µs
+        constexpr const uint16_t GAP_REFERENCE_US{1000};
+
+        // beim Messen des Mindestabstands aufsteigend geprüfte Abstände in µs
+        constexpr const uint16_t GAP_CANDIDATES_US[]{0, 25, 50, 100, 150, 200, 300, 500};
+
+        // Anzahl der Versuche je geprüftem Abstand
+        constexpr ControlConstant GAP_TRIALS{3};
+
+        // Anzahl aufeinanderfolgender ungültiger Datensätze, nach der das Gerät als getrennt gilt
+        // (z. B. Initialisierung nach Spannungseinbruch verloren)
+        constexpr ControlConstant MAX_INVALID_FRAMES{8};
+
+        // Wartezeit nach dem ersten fehlgeschlagenen Verbindungsaufbau in µs, verdoppelt sich
+        // mit jedem weiteren Fehlschlag
+        constexpr const unsigned long RECONNECT_MIN_US{10000};
+
+        // maximale Wartezeit zwischen zwei Verbindungsaufbauten in µs
+        constexpr const unsigned long RECONNECT_MAX_US{500000};
+    };
+
+    // Verschlüsselter Modus älterer Geräte und Nachbauten
+    namespace Encryption
+    {
+        using EncryptionConstant = const uint8_t;
+
+        // Registeradresse der Initialisierung im verschlüsselten Modus
+        constexpr EncryptionConstant REG_INIT{0x40};
+
+        // Wert der Initialisierung im verschlüsselten Modus (Schlüssel 0)
+        constexpr EncryptionConstant VAL_INIT{0x00};
+
+        // Entschlüsselungstabelle, Eintrag x entspricht (x ^ 0x17) + 0x17
+        extern const uint8_t DECRYPT_TABLE[256] PROGMEM;
+
+        /**
+         * @brief   Entschlüsselt ein empfangenes Byte mit einem Tabellenzugriff
+         * 
+         * @param data verschlüsseltes Byte
+         * @return uint8_t entschlüsseltes Byte
+         */
+        inline const uint8_t decrypt(const uint8_t data)
+        {
+            return pgm_read_byte(&DECRYPT_TABLE[data]);
+        }
     };
 
     
@@ -177,6 +257,52 @@ namespace communication
         constexpr BitmaskConstant ACC_Z_BIT_0_1{0xC0};
     };
 
+    /**
+     * @brief   Ein vollständiger Datensatz des Nunchuks, wie er über den I2C-Bus empfangen wird.
+     *          Stellt die Dekodierung der einzelnen Sensorwerte bereit.
+     */
+    struct Frame
+    {
+        // Rohdaten vom Nunchuk
+        uint8_t raw[Control::LEN_RAW_DATA];
+
+        /**
+         * @brief   Prüft den Datensatz auf offensichtlich ungültige Inhalte, wie sie z. B. bei
+         *          einem halb gesteckten Kabel auftreten (alle Bytes 0x00 oder 0xFF)
+         * 
+         * @return  true Datensatz ist plausibel
+         */
+        const bool isPlausible() const;
+
+        /**
+         * @brief   Vergleicht die Rohdaten zweier Datensätze
+         */
+        const bool operator==(const Frame &other) const;
+
+        /**
+         * @brief   Erzeugt einen neutralen Datensatz: Joystick in der Mitte, Beschleunigung 0,
+         *          Buttons losgelassen
+         * 
+         * @param centerX Mittenwert des Joysticks in X-Richtung
+         * @param centerY Mittenwert des Joysticks in Y-Richtung
+         */
+        static const Frame neutral(const uint8_t centerX, const uint8_t centerY);
+
+        // Dekodierung der Sensorwerte, siehe gleichnamige Methoden der Klasse Nunchuk
+
+        const bool decodeButtonZ() const;
+        const bool decodeButtonC() const;
+        const int16_t decodeAccelerationX() const;
+        const int16_t decodeAccelerationY() const;
+        const int16_t decodeAccelerationZ() const;
+        const int16_t decodeJoystickX() const;
+        const int16_t decodeJoystickY() const;
+
+        // Auslenkung des Joysticks relativ zum übergebenen Mittenwert
+        const int16_t decodeJoystickX(const uint8_t center) const;
+        const int16_t decodeJoystickY(const uint8_t center) const;
+    };
+
     /************************************
      * Definitionen statischer Methoden *
      ************************************/
@@ -214,7 +340,7 @@ namespace communication
    * @annotation    Inhalt der Meldung
    * @code          Code des auslösenden Fehlers
    */
-  void serialerror(const char *annotation, const uint16_t code);
+  void serialerror(const char *annotation, const State code);
 
     /*************************************
      * Definitionen statischer Variablen *
@@ -233,8 +359,28 @@ namespace communication
     /**
      * @brief   Klasse Nunchuk kommuniziert mit einem Nunchuk und verarbeitet und speichert die
      *          empfangenen Sensorendaten.
+     *          Über die Policies werden nicht benötigte Funktionen zur Übersetzungszeit entfernt,
+     *          siehe NunchukPolicies.h.
+     *
+     * @tparam  Bus Bus-Policy der I2C-Schnittstelle, z. B. WireBus
+     * @tparam  LevelShifterPolicy NoLevelShifter, LevelShifter oder OptionalLevelShifter
+     * @tparam  Debounce NoDebounce oder ButtonDebounce
+     * @tparam  Filter NoFilter oder ein Filter der Beschleunigungswerte, z. B. MovingAverageFilter
+     * @tparam  Timer NoCycleTimer oder CycleTimer
+     * @tparam  Features beliebig viele Erweiterungs-Policies, jede einzeln: MultiplexerSupport,
+     *          ProfileSupport, AutoCenterSupport, PublisherSupport, GestureSupport,
+     *          FailsafeSupport, StartupTiming. Der Header der Erweiterung wird nur für die
+     *          verwendeten Policies benötigt.
      */
-    class Nunchuk
+    template<
+        class Bus,
+        class LevelShifterPolicy,
+        class Debounce,
+        class Filter,
+        class Timer = CycleTimer,
+        class... Features
+    >
+    class NunchukT
     {
     public:
         // Konstruktoren
@@ -247,7 +393,7 @@ namespace communication
          * @param cycletime Zykluszeit nach der wieder Daten angefordert werden in ms
          * @param mode Taktfrequenz der I2C-Schnittstelle
          */
-        Nunchuk(const unsigned long buttonTimeout,
+        NunchukT(const unsigned long buttonTimeout,
             const unsigned long cycletime = 30,
             const ClockMode mode = ClockMode::I2C_CLOCK_FAST_400_kHz);
 
@@ -261,7 +407,7 @@ namespace communication
          * @param cycletime Zykluszeit nach der wieder Daten angefordert werden in ms
          * @param mode Taktfrequenz der I2C-Schnittstelle
          */
-        Nunchuk(const uint8_t lvlshft,
+        NunchukT(const uint8_t lvlshft,
             const unsigned long buttonTimeout,
             const unsigned long cycletime = 30,
             const ClockMode mode = ClockMode::I2C_CLOCK_FAST_400_kHz);
@@ -277,7 +423,7 @@ namespace communication
          * @param cycletime Zykluszeit nach der wieder Daten angefordert werden in ms
          * @param mode Taktfrequenz der I2C-Schnittstelle
          */
-        Nunchuk(const uint8_t lvlshft,
+        NunchukT(const uint8_t lvlshft,
             const unsigned long cTimeout, const unsigned long zTimeout,
             const unsigned long cycletime = 30,
             const ClockMode mode = ClockMode::I2C_CLOCK_FAST_400_kHz);
@@ -286,7 +432,7 @@ namespace communication
          * @brief   Destruktor der Klasse Nunchuk.
          *          Gibt den I2C-Bus wieder frei.
          */
-        ~Nunchuk();
+        ~NunchukT();
 
         // Getter und Setter
 
@@ -297,6 +443,26 @@ namespace communication
          */
         const bool isConnected() const;
 
+        /**
+         * @brief   Gibt die Bus-Policy zurück, z. B. um sie vor begin() zu konfigurieren
+         * 
+         * @return  Bus& Referenz auf den Bus
+         */
+        Bus &bus()
+        {
+            return m_bus;
+        }
+
+        /**
+         * @brief   Gibt die Filter-Policy zurück, z. B. um neue Ausgabewerte zu erkennen
+         * 
+         * @return  const Filter& Referenz auf den Filter
+         */
+        const Filter &filter() const
+        {
+            return m_filter;
+        }
+
         /**
          * @brief   Gibt den aktuellen Zustand des Automaten zurück
          * 
@@ -304,22 +470,241 @@ namespace communication
          */
         const State getState() const;
 
+        /**
+         * @brief   Erstellt eine konsistente Kopie des zuletzt empfangenen Datensatzes.
+         *          Kann ohne Sperren aufgerufen werden, auch wenn read() in einer ISR oder einem
+         *          anderen Task läuft.
+         * 
+         * @return  Frame Kopie des aktuellen Datensatzes
+         */
+        const Frame snapshot() const;
+
+        /**
+         * @brief   Gibt die Anzahl der Lesewiederholungen zurück, die durch gleichzeitiges
+         *          Veröffentlichen neuer Datensätze notwendig wurden
+         * 
+         * @return  uint32_t Summe der Wiederholungen
+         */
+        const uint32_t snapshotRetries() const;
+
+        /**
+         * @brief   Gibt die Anzahl der verworfenen, unplausiblen Datensätze zurück
+         * 
+         * @return  uint32_t Anzahl ungültiger Datensätze
+         */
+        const uint32_t invalidFrames() const;
+
+        /**
+         * @brief   Gibt die Anzahl der Datensätze zurück, die dem vorherigen glichen und daher
+         *          nicht erneut verarbeitet wurden
+         * 
+         * @return  uint32_t Anzahl doppelter Datensätze
+         */
+        const uint32_t duplicateFrames() const;
+
+        /**
+         * @brief   Gibt zurück, ob der zuletzt von read() empfangene Datensatz dem vorherigen
+         *          glich
+         * 
+         * @return  true unveränderter Datensatz | false neuer Datensatz bzw. keiner empfangen
+         */
+        const bool isDuplicate() const;
+
         // Andere Methoden
 
         /**
          * @brief   Initialisierungssequenz für den Nunchuk, um mit ihm kommunizieren zu können.
          *          Deaktiviert die Verschlüsselung.
+         *          Meldet sich das Gerät bereits mit der ID eines initialisierten Nunchuks
+         *          (z. B. nach einem Reset nur des Controllers), entfällt die Sequenz (Warmstart).
          *
          * @return  enum class Exitcode der Methode
          */
         State begin();
 
+        /**
+         * @brief   Gibt zurück, ob beim letzten Aufruf von begin() die Initialisierung
+         *          übersprungen wurde
+         * 
+         * @return  true Warmstart | false Kaltstart
+         */
+        const bool isWarmStart() const;
+
+        /**
+         * @brief   Gibt zurück, ob das Gerät im verschlüsselten Modus betrieben wird. Der Modus
+         *          wird in begin() anhand der ID erkannt.
+         * 
+         * @return  true Datensätze werden entschlüsselt
+         */
+        const bool isEncrypted() const;
+
+        /**
+         * @brief   Gibt die Zeit vom Aufruf von begin() bis zum ersten veröffentlichten
+         *          Datensatz zurück (inkl. Wartezeit bis zum ersten fälligen Zyklus)
+         * 
+         * @return  unsigned long Zeitspanne in µs, 0 solange noch kein Datensatz vorliegt bzw.
+         *          ohne die Policy StartupTiming
+         */
+        const unsigned long timeToFirstSample() const;
+
+        /**
+         * @brief   Gibt die Zeitspanne bis zum nächsten Ereignis des Treibers zurück: Ablauf der
+         *          Zykluszeit, Ablauf der Entprellung eines Buttons, nächster Versuch des
+         *          Verbindungsaufbaus, Frist von Gestenerkennung oder Failsafe. Bis dahin darf
+         *          die Anwendung z. B. schlafen.
+         * 
+         * @return  unsigned long Zeitspanne in µs ab Clock::current(), 0 falls bereits
+         *          fällig, Clock::NEVER falls kein Ereignis ansteht (z. B. NoCycleTimer)
+         */
+        const unsigned long timeUntilNextEvent() const;
+
+        /**
+         * @brief   Legt fest, wann der Registerzeiger für den nächsten Datensatz gesetzt wird.
+         *          Im Pipeline-Betrieb (Standard) direkt nach dem Auslesen, die Wandlung läuft
+         *          dann bis zur nächsten Abfrage, und read() belegt den Bus nur für das Lesen;
+         *          der Datensatz ist dafür bis zu einer Zykluszeit alt. Sonst setzt read() den
+         *          Zeiger, wartet den Mindestabstand ab und liest einen frischen Datensatz.
+         * 
+         * @param pipelined Pipeline-Betrieb
+         */
+        void setPipelined(const bool pipelined);
+
+        /**
+         * @brief   Gibt zurück, ob der Pipeline-Betrieb aktiv ist
+         */
+        const bool isPipelined() const;
+
+        /**
+         * @brief   Misst den Mindestabstand zwischen Setzen des Registerzeigers und Auslesen,
+         *          ab dem das Gerät keine unvollständigen (0xFF) oder veralteten (Wiederholung
+         *          des vorherigen) Datensätze mehr liefert, und übernimmt ihn mit 25 % Reserve.
+         *          begin() misst ihn beim ersten erfolgreichen Verbindungsaufbau, nach einem
+         *          Gerätewechsel kann erneut gemessen werden. Ist ein Profilspeicher festgelegt,
+         *          wird er im Profil abgelegt und nach einem Neustart des Controllers
+         *          übernommen statt erneut gemessen.
+         *          Liefert bereits das ruhende Gerät bei sicherem Abstand gleiche Datensätze,
+         *          sind veraltete Datensätze nicht erkennbar: es gilt dann der sichere
+         *          Standardwert Control::DELAY_REGISTER_US, der weder als gemessen gilt noch
+         *          im Profil abgelegt wird.
+         * 
+         * @return  unsigned long Mindestabstand in µs, bei Übertragungsfehlern der bisherige
+         */
+        const unsigned long tuneConversionGap();
+
+        /**
+         * @brief   Gibt den Mindestabstand zwischen Setzen des Registerzeigers und Auslesen
+         *          zurück
+         * 
+         * @return  unsigned long Mindestabstand in µs
+         */
+        const unsigned long conversionGap() const;
+
         /**
          * @brief   Liest die aktuellen Sensorwerte vom Nunchuk über den I2C-Bus.
+         *          Unplausible Datensätze werden verworfen (BAD_VALUE). Ein gültiger, aber
+         *          unveränderter Datensatz ergibt wie ein neuer CONNECTED, wird jedoch nicht
+         *          erneut dekodiert und verteilt; ob er sich geändert hat, gibt isDuplicate()
+         *          zurück. NO_DATA_AVAILABLE bedeutet, dass in diesem Aufruf kein Datensatz
+         *          empfangen wurde (Zykluszeit noch nicht abgelaufen, gerade neu verbunden).
          *
          * @return  enum class Exitcode der Methode
          */
         State read();
+
+        /**
+         * @brief   Meldet den Nunchuk bei einem Scheduler an, der die Transaktionen mehrerer
+         *          Geräte am selben Bus verteilt. Die Zykluszeit wird als Periode verwendet.
+         *          Ohne Scheduler entscheidet read() allein anhand der Zykluszeit.
+         * 
+         * @param scheduler Scheduler des Busses
+         * @return  true Anmeldung erfolgreich
+         * @return  false kein freier Platz beim Scheduler
+         */
+        const bool attach(BusScheduler &scheduler);
+
+        /**
+         * @brief   Meldet den Nunchuk vom Scheduler ab
+         */
+        void detach();
+
+        /**
+         * @brief   Legt fest, dass der Nunchuk hinter einem Kanal eines I2C-Multiplexers hängt.
+         *          Der Kanal wird vor jeder Transaktion ausgewählt, sofern er nicht bereits
+         *          verbunden ist. Erfordert die Policy MultiplexerSupport.
+         * 
+         * @param mux Multiplexer, an dem der Nunchuk angeschlossen ist
+         * @param channel Kanal des Multiplexers
+         */
+        template<class Support = MultiplexerSupport>
+        void setMultiplexer(I2CMultiplexer &mux, const uint8_t channel)
+        {
+            static_assert(has<Support>(), "Der Multiplexer erfordert die Policy MultiplexerSupport");
+            feature<Support>().attach(mux, channel);
+        }
+
+        /**
+         * @brief   Führt die Mittenwerte des Joysticks im laufenden Betrieb mit dem übergebenen
+         *          Schätzer nach. Der Schätzer startet mit den aktuellen Mittenwerten und wird
+         *          bei jeder neuen Kalibrierung zurückgesetzt. Erfordert die Policy
+         *          AutoCenterSupport.
+         * 
+         * @param estimator Schätzer der Mittenwerte
+         */
+        template<class Support = AutoCenterSupport>
+        void setAutoCenter(AutoCenter &estimator)
+        {
+            static_assert(has<Support>(), "Die Nachführung der Mittenwerte erfordert die Policy AutoCenterSupport");
+            feature<Support>().attach(estimator, m_joystickXNull, m_joystickYNull);
+        }
+
+        /**
+         * @brief   Verteilt jeden neuen Datensatz über den übergebenen Publisher an dessen
+         *          Abonnenten. Dekodiert werden nur die Felder der fälligen Abonnenten, einmal
+         *          je Datensatz innerhalb von read(). Erfordert die Policy PublisherSupport.
+         * 
+         * @param publisher Publisher mit den Abonnenten
+         */
+        template<class Support = PublisherSupport>
+        void setPublisher(Publisher &publisher)
+        {
+            static_assert(has<Support>(), "Abonnenten erfordern die Policy PublisherSupport");
+            feature<Support>().attach(publisher);
+        }
+
+        /**
+         * @brief   Erkennt Gesten beider Buttons (langer Druck, Doppelklick, C+Z) mit der
+         *          übergebenen Erkennung. read() übergibt ihr bei jedem Aufruf die (ggf.
+         *          entprellten) Gedrücktzustände, auch zwischen den Abfragen des Geräts.
+         *          Eine zuvor festgelegte Erkennung wird ersetzt. Erfordert die Policy
+         *          GestureSupport.
+         * 
+         * @param recognizer Gestenerkennung
+         */
+        template<class Support = GestureSupport>
+        void setGestures(GestureRecognizer &recognizer)
+        {
+            static_assert(has<Support>(), "Gesten erfordern die Policy GestureSupport");
+            feature<Support>().attach(recognizer);
+        }
+
+        /**
+         *  @brief  Überwacht das Alter der Datensätze mit dem übergebenen Failsafe. Löst er aus
+         *          (Frist abgelaufen oder Verbindung verloren), veröffentlicht read() einen
+         *          neutralen Datensatz, lässt die Buttons ohne Entprellung los und setzt die
+         *          Gestenerkennung zurück; filteredAcceleration*() liefern 0. Bis zum ersten
+         *          frischen Datensatz sind die Ausgaben ebenfalls neutral.
+         *          Ein zuvor festgelegter Failsafe wird ersetzt. Erfordert die Policy
+         *          FailsafeSupport.
+         * 
+         * @param failsafe Failsafe mit Frist und Ereignissen
+         */
+        template<class Support = FailsafeSupport>
+        void setFailsafe(Failsafe &failsafe)
+        {
+            static_assert(has<Support>(), "Der Failsafe erfordert die Policy FailsafeSupport");
+            feature<Support>().attach(failsafe);
+            neutralize();
+        }
         
         /**
          * @brief Bestimmt den Gedrücktzustand des Buttons C
@@ -342,7 +727,8 @@ namespace communication
         */
         void onPressedC(void const (*pressedCallback)(void))
         {
-            m_buttonC.onPressed(pressedCallback);
+            static_assert(Debounce::ENABLED, "Callbacks erfordern die Policy ButtonDebounce");
+            m_debounce.buttonC().onPressed(pressedCallback);
         }
 
         /**
@@ -352,7 +738,66 @@ namespace communication
         */
         void onPressedZ(void const (*pressedCallback)(void))
         {
-            m_buttonZ.onPressed(pressedCallback);
+            static_assert(Debounce::ENABLED, "Callbacks erfordern die Policy ButtonDebounce");
+            m_debounce.buttonZ().onPressed(pressedCallback);
+        }
+
+        /**
+        * @brief Registriert einen Delegaten, der beim Drücken des Buttons C aufgerufen wird.
+        *
+        * @param pressedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+        */
+        void onPressedC(const ButtonDelegate pressedDelegate)
+        {
+            static_assert(Debounce::ENABLED, "Delegaten erfordern die Policy ButtonDebounce");
+            m_debounce.buttonC().onPressed(pressedDelegate);
+        }
+
+        /**
+        * @brief Registriert einen Delegaten, der beim Drücken des Buttons Z aufgerufen wird.
+        *
+        * @param pressedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+        */
+        void onPressedZ(const ButtonDelegate pressedDelegate)
+        {
+            static_assert(Debounce::ENABLED, "Delegaten erfordern die Policy ButtonDebounce");
+            m_debounce.buttonZ().onPressed(pressedDelegate);
+        }
+
+        /**
+        * @brief Registriert einen Delegaten, der beim Loslassen des Buttons C aufgerufen wird.
+        *
+        * @param releasedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+        */
+        void onReleasedC(const ButtonDelegate releasedDelegate)
+        {
+            static_assert(Debounce::ENABLED, "Delegaten erfordern die Policy ButtonDebounce");
+            m_debounce.buttonC().onReleased(releasedDelegate);
+        }
+
+        /**
+        * @brief Registriert einen Delegaten, der beim Loslassen des Buttons Z aufgerufen wird.
+        *
+        * @param releasedDelegate Delegat mit Kontext, ein leerer Delegat deregistriert ihn
+        */
+        void onReleasedZ(const ButtonDelegate releasedDelegate)
+        {
+            static_assert(Debounce::ENABLED, "Delegaten erfordern die Policy ButtonDebounce");
+            m_debounce.buttonZ().onReleased(releasedDelegate);
+        }
+
+        /**
+        * @brief Verbindet beide Buttons mit einer Ereigniswarteschlange. read() hängt dann nur
+        *        noch Ereignisse an, die Anwendung arbeitet sie später mit Button::drain() ab.
+        *
+        * @param queue Ereigniswarteschlange
+        * @param device Kennung des Nunchuks in den Ereignissen
+        */
+        void attach(EventQueue<ButtonEvent> &queue, const uint8_t device = 0)
+        {
+            static_assert(Debounce::ENABLED, "Ereignisse erfordern die Policy ButtonDebounce");
+            m_debounce.buttonC().attach(queue, device);
+            m_debounce.buttonZ().attach(queue, device);
         }
 
         /**
@@ -371,30 +816,31 @@ namespace communication
 
         /**
          * @brief   Extrahiert die Bits [0:1] des Beschleunigungswerts in X-Richtung aus dem
-         *          zusammengesetzten Register, setzt sie mit den Bits [2:1] zusammen.
+         *          zusammengesetzten Register, setzt sie mit den Bits [2:9] zusammen.
          * 
-         * @return  int16_t Beschleunigungswert in X-Richtung (-512;512]
+         * @return  int16_t Beschleunigungswert in X-Richtung [-512;511]
          */
         const int16_t decodeAccelerationX() const;
 
         /**
          * @brief   Extrahiert die Bits [0:1] des Beschleunigungswerts in Y-Richtung aus dem
-         *          zusammengesetzten Register, setzt sie mit den Bits [2:10] zusammen.
+         *          zusammengesetzten Register, setzt sie mit den Bits [2:9] zusammen.
          * 
-         * @return  int16_t Beschleunigungswert in Y-Richtung (-512;512]
+         * @return  int16_t Beschleunigungswert in Y-Richtung [-512;511]
          */
         const int16_t decodeAccelerationY() const;
 
         /**
          * @brief   Extrahiert die Bits [0:1] des Beschleunigungswerts in Z-Richtung aus dem
-         *          zusammengesetzten Register, setzt sie mit den Bits [2:10] zusammen.
+         *          zusammengesetzten Register, setzt sie mit den Bits [2:9] zusammen.
          * 
-         * @return  int16_t Beschleunigungswert in Z-Richtung (-512;512]
+         * @return  int16_t Beschleunigungswert in Z-Richtung [-512;511]
          */
         const int16_t decodeAccelerationZ() const;
 
         /**
          * @brief   Subtrahiert den Mittenwert vom Registerwert für die Position in X-Richtung.
+         *          Auslenkungen innerhalb des Totbereichs werden zu 0.
          *          
          * @return  int8_t Joystickauslenkung relativ zur Mitte in X-Richtung (-125;130]
          */
@@ -402,11 +848,107 @@ namespace communication
 
         /**
          * @brief   Subtrahiert den Mittenwert vom Registerwert für die Position in Y-Richtung.
+         *          Auslenkungen innerhalb des Totbereichs werden zu 0.
          *          
          * @return  int8_t Joystickauslenkung relativ zur Mitte in Y-Richtung (-126;129]
          */
         const int16_t decodeJoystickY() const;
 
+        /**
+         * @brief   Legt den Speicher für das Geräteprofil fest. begin() lädt das Profil dann mit
+         *          einem Lesezugriff und liest die Kalibrierungsdaten. Da alle Originalgeräte
+         *          dieselbe ID melden, gehört das Profil nur zum angeschlossenen Gerät, wenn
+         *          zusätzlich die Prüfsumme der Kalibrierungsdaten übereinstimmt. Dann werden
+         *          Mittenwerte, Totbereich und Mindestabstand (siehe tuneConversionGap()) aus dem
+         *          Profil übernommen, andernfalls werden die Mittenwerte der Kalibrierungsdaten
+         *          übernommen und das Profil gespeichert. Erfordert die Policy ProfileSupport.
+         * 
+         * @param storage nichtflüchtiger Speicher, z. B. EepromStorage oder EmulatedEeprom
+         * @param address Adresse des Profils im Speicher
+         */
+        template<class Support = ProfileSupport>
+        void setProfileStorage(ProfileStorage &storage, const uint16_t address = 0)
+        {
+            static_assert(has<Support>(), "Geräteprofile erfordern die Policy ProfileSupport");
+            feature<Support>().attach(storage, address);
+        }
+
+        /**
+         * @brief   Gibt zurück, ob beim letzten Aufruf von begin() ein passendes Profil
+         *          geladen wurde
+         * 
+         * @return  true Profil geladen | false kalibriert bzw. kein Speicher festgelegt
+         */
+        const bool hasProfile() const;
+
+        /**
+         * @brief   Liest die Kalibrierungsdaten des Geräts und übernimmt die Mittenwerte des
+         *          Joysticks. Ist ein Profilspeicher festgelegt, wird das Profil aktualisiert.
+         * 
+         * @return  true Kalibrierungsdaten gültig und übernommen
+         * @return  false Übertragungsfehler oder ungültige Prüfsumme
+         */
+        const bool calibrate();
+
+        /**
+         * @brief   Speichert Mittenwerte, Totbereich, gemessenen Mindestabstand und die
+         *          Prüfsumme der Kalibrierungsdaten als Profil des angeschlossenen Geräts
+         * 
+         * @return  true Profil gespeichert
+         * @return  false kein Profilspeicher festgelegt oder Schreibfehler
+         */
+        const bool saveProfile();
+
+        /**
+         * @brief   Setzt den Totbereich des Joysticks um die Mitte
+         * 
+         * @param deadzone Totbereich in Zählschritten
+         */
+        void setDeadzone(const uint8_t deadzone);
+
+        /**
+         * @brief   Gibt den aktuellen Mittenwert des Joysticks in X-Richtung zurück
+         *          (Kalibrierung, Profil oder automatische Nachführung)
+         * 
+         * @return  uint8_t Registerwert der Mitte in X-Richtung
+         */
+        const uint8_t joystickCenterX() const;
+
+        /**
+         * @brief   Gibt den aktuellen Mittenwert des Joysticks in Y-Richtung zurück
+         *          (Kalibrierung, Profil oder automatische Nachführung)
+         * 
+         * @return  uint8_t Registerwert der Mitte in Y-Richtung
+         */
+        const uint8_t joystickCenterY() const;
+
+        /**
+         * @brief   Gibt den gefilterten Beschleunigungswert in X-Richtung zurück.
+         *          Ohne Filter entspricht er decodeAccelerationX(), die Auflösung hängt vom
+         *          Filter ab (siehe DecimationFilter).
+         * 
+         * @return  int16_t gefilterter Beschleunigungswert in X-Richtung
+         */
+        const int16_t filteredAccelerationX() const;
+
+        /**
+         * @brief   Gibt den gefilterten Beschleunigungswert in Y-Richtung zurück.
+         *          Ohne Filter entspricht er decodeAccelerationY(), die Auflösung hängt vom
+         *          Filter ab (siehe DecimationFilter).
+         * 
+         * @return  int16_t gefilterter Beschleunigungswert in Y-Richtung
+         */
+        const int16_t filteredAccelerationY() const;
+
+        /**
+         * @brief   Gibt den gefilterten Beschleunigungswert in Z-Richtung zurück.
+         *          Ohne Filter entspricht er decodeAccelerationZ(), die Auflösung hängt vom
+         *          Filter ab (siehe DecimationFilter).
+         * 
+         * @return  int16_t gefilterter Beschleunigungswert in Z-Richtung
+         */
+        const int16_t filteredAccelerationZ() const;
+
         void print();
 
     private:
@@ -424,48 +966,262 @@ namespace communication
          */
         void disable() const;
 
-        class ButtonC : public Button
-        {
-        	public:
-                using Button::Button;
-                ButtonC(const Nunchuk *dev, const unsigned long duration);
+        /**
+         * @brief   Wählt ggf. den Kanal des Multiplexers aus
+         * 
+         * @return  true Nunchuk ist mit dem Bus verbunden
+         * @return  false Kanal konnte nicht ausgewählt werden
+         */
+        const bool select();
+
+        /**
+         * @brief   Setzt den Registerzeiger und liest anschließend einen Registerbereich aus
+         * 
+         * @param reg Adresse des ersten Registers
+         * @param data Ziel der gelesenen Daten
+         * @param length Anzahl der zu lesenden Bytes
+         * @return  true alle Bytes gelesen
+         * @return  false Übertragungsfehler
+         */
+        const bool readRegister(const uint8_t reg, uint8_t *data, const uint8_t length);
+
+        /**
+         * @brief   Setzt den Registerzeiger auf die Sensordaten und merkt sich den Zeitpunkt
+         * 
+         * @return  true Übertragung erfolgreich
+         */
+        const bool writePointer();
+
+        /**
+         * @brief   Wartet, bis seit dem Setzen des Registerzeigers der Mindestabstand vergangen
+         *          ist
+         */
+        void awaitConversion() const;
+
+        /**
+         * @brief   Setzt den Registerzeiger, wartet die übergebene Zeitspanne und liest einen
+         *          Datensatz
+         * 
+         * @param gap Abstand zwischen Setzen des Zeigers und Auslesen in µs
+         * @param frame Ziel des Datensatzes
+         * @return  true alle Bytes gelesen
+         */
+        const bool sampleFrame(const unsigned long gap, Frame &frame);
+
+        /**
+         * @brief   Misst den Mindestabstand, der Bus muss bereits aktiviert sein. Liefert das
+         *          ruhende Gerät nur gleiche Datensätze, gilt der Standardwert
+         *          Control::DELAY_REGISTER_US als nicht gemessen.
+         * 
+         * @return  true Mindestabstand gemessen und übernommen
+         */
+        const bool measureConversionGap();
+
+        /**
+         * @brief   Liest die ID des Geräts und prüft, ob es bereits initialisiert ist. In diesem
+         *          Fall wird der Registerzeiger auf die Sensordaten gesetzt.
+         * 
+         * @return  true Gerät meldet die ID eines initialisierten Nunchuks
+         * @return  false Gerät muss initialisiert werden
+         */
+        const bool probe();
+
+        /**
+         * @brief   Führt die Initialisierungssequenz durch und erkennt anhand der ID, ob das
+         *          Gerät unverschlüsselt (0xF0/0x55, 0xFB/0x00) oder nur im verschlüsselten
+         *          Modus (0x40/0x00) arbeitet. Die ID wird für das Geräteprofil abgelegt.
+         * 
+         * @return  enum class CONNECTED bei Erfolg, sonst NOT_CONNECTED
+         */
+        const State initialize();
+
+        /**
+         * @brief   Sendet die Initialisierungssequenz des unverschlüsselten Modus
+         * 
+         * @return  uint8_t Rückgabewert der letzten Übertragung (WireReturnCode)
+         */
+        const uint8_t initializePlain();
+
+        /**
+         * @brief   Sendet die Initialisierung des verschlüsselten Modus
+         * 
+         * @return  uint8_t Rückgabewert der Übertragung (WireReturnCode)
+         */
+        const uint8_t initializeEncrypted();
+
+        /**
+         * @brief   Liest die ID und prüft sie auf die eines Nunchuks
+         * 
+         * @param encrypted ID ist verschlüsselt
+         * @return  true ID gelesen und gültig
+         */
+        const bool readId(const bool encrypted);
 
-        		const State getState() const override;
+        /**
+         * @brief   Liest die Kalibrierungsdaten und übernimmt die Mittenwerte des Joysticks.
+         *          Der Bus muss bereits aktiviert sein.
+         * 
+         * @return  true Kalibrierungsdaten gültig und übernommen
+         */
+        const bool readCalibration();
 
-            private:
-                const Nunchuk *m_device; // Gerät dessen Button überwacht werden soll 
-        };
+        /**
+         * @brief   Berechnet die kalibrierte Auslenkung des Joysticks eines Datensatzes
+         */
+        const int16_t joystickX(const Frame &frame) const;
+        const int16_t joystickY(const Frame &frame) const;
 
+        /**
+         * @brief   Dekodiert die Felder der fälligen Abonnenten und stellt den aktuellen
+         *          Datensatz zu, ohne die Policy PublisherSupport entfällt der Aufruf
+         * 
+         * @param all alle Abonnenten sind fällig (neutraler Datensatz des Failsafe)
+         */
+        void distribute(const bool all = false);
+
+        /**
+         * @brief   Übergibt der Gestenerkennung die Gedrücktzustände, ohne die Policy
+         *          GestureSupport entfällt der Aufruf
+         */
+        void updateGestures();
+
+        /**
+         * @brief   Meldet dem Failsafe einen frischen Datensatz bzw. den Verlust der Verbindung
+         * 
+         * @param fresh vollständiger, plausibler Datensatz empfangen
+         */
+        void supervise(const bool fresh);
+
+        /**
+         * @brief   Veröffentlicht einen neutralen Datensatz und lässt die Buttons los
+         */
+        void neutralize();
+
+        /**
+         * @brief   Setzt Auslenkungen innerhalb des Totbereichs auf 0
+         */
+        const int16_t applyDeadzone(const int16_t value) const;
 
-        class ButtonZ : public Button
+        /**
+         * @brief   Legt die ID des Geräts für das Geräteprofil ab, ohne die Policy
+         *          ProfileSupport entfällt sie
+         */
+        void storeId(const uint8_t *id);
+
+        /**
+         * @brief   Gibt zurück, ob die Erweiterungs-Policy Feature verwendet wird
+         */
+        template<class Feature>
+        static constexpr const bool has()
         {
-        	public:
-                using Button::Button;
-                ButtonZ(const Nunchuk *dev, const unsigned long duration);
+            return containsFeature<Feature, Features...>();
+        }
 
-        		const State getState() const override;
+        /**
+         * @brief   Gibt den Zustand der Erweiterungs-Policy Feature zurück, nur innerhalb von
+         *          if constexpr (has<Feature>()) verwenden
+         */
+        template<class Feature>
+        typename FeatureSet<Features...>::template Type<Feature> &feature()
+        {
+            return m_features;
+        }
 
-            private:
-                const Nunchuk *m_device; // Gerät dessen Button überwacht werden soll 
-        };
-        
-        ButtonC m_buttonC; // Repräsentation des C-Buttons
-        ButtonZ m_buttonZ; // Repräsentation des Z-Buttons
+        template<class Feature>
+        const typename FeatureSet<Features...>::template Type<Feature> &feature() const
+        {
+            return m_features;
+        }
+
+        /**
+         * @brief   Gibt die kürzere der beiden Zeitspannen bis zum nächsten Ereignis zurück
+         * 
+         * @param next bisher nächstes Ereignis in µs
+         * @param deadline Zeitgeber mit festem Platz
+         * @param now Zeitpunkt in µs
+         */
+        static const unsigned long earliest(const unsigned long next, const Deadline &deadline,
+            const unsigned long now);
 
-        // Enable Pin des Pegelwandlers für den I2C-Bus
-        const uint8_t m_pinLevelshifter;
+        // I2C-Schnittstelle
+        Bus m_bus;
 
-        // Rohdaten vom Nunchuk
-        uint8_t m_raw[Control::LEN_RAW_DATA];
+        // Pegelwandler für den I2C-Bus
+        const LevelShifterPolicy m_levelShifter;
+
+        // Entprellung der Buttons
+        Debounce m_debounce;
+
+        // Filter der Beschleunigungswerte
+        Filter m_filter;
+
+        // Zykluszeit bzw. Anbindung an den BusScheduler
+        Timer m_timer;
+
+        // Zustand der Erweiterungs-Policies, ohne Policies leer
+        FeatureSet<Features...> m_features;
+
+        // doppelt gepufferte Rohdaten vom Nunchuk
+        SeqLock<Frame> m_frame;
 
         // aktueller Zustand des Automaten
         State m_state;
 
-        // Zeitspanne nach der erneut Daten vom Nunchuk angefordert werden
-        const unsigned long m_cycletime;
+        // Anzahl verworfener, unplausibler Datensätze
+        uint32_t m_invalidFrames;
+
+        // Anzahl unveränderter Datensätze
+        uint32_t m_duplicateFrames;
+
+        // Wartezeit bis zum nächsten Verbindungsaufbau nach einem Fehlschlag
+        Deadline m_reconnect;
+
+        // Zeitpunkt des letzten Setzens des Registerzeigers in µs (Clock::current())
+        unsigned long m_pointerTime;
+
+        // Mindestabstand zwischen Setzen des Registerzeigers und Auslesen in µs
+        uint16_t m_gap;
+
+        // Mittenwerte des Joysticks
+        uint8_t m_joystickXNull;
+        uint8_t m_joystickYNull;
+
+        // Totbereich des Joysticks um die Mitte
+        uint8_t m_deadzone;
+
+        // letzter Aufruf von begin() war ein Warmstart
+        bool m_warmStart;
+
+        // Gerät arbeitet im verschlüsselten Modus
+        bool m_encrypted;
 
-        // Zeitpunkt zu dem zuletzt neue Daten angefordert wurden
-        unsigned long m_lastFetch;
+        // Anzahl der unmittelbar aufeinanderfolgenden ungültigen Datensätze
+        uint8_t m_invalidRun;
+
+        // Anzahl der Verdopplungen der Wartezeit seit dem letzten erfolgreichen Verbindungsaufbau
+        uint8_t m_backoff;
+
+        // Registerzeiger direkt nach dem Auslesen setzen
+        bool m_pipelined;
+
+        // Mindestabstand wurde gemessen
+        bool m_gapMeasured;
+
+        // zuletzt empfangener Datensatz glich dem vorherigen
+        bool m_duplicate;
     };
+
+    /**
+     * @brief   Nunchuk in der bisherigen Konfiguration: Hardware-I2C, optionaler Pegelwandler,
+     *          entprellte Buttons, keine Filterung und feste Zykluszeit. Erweiterungen werden
+     *          einzeln über eigene Policies hinzugefügt, siehe NunchukT.
+     */
+    using Nunchuk = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer>;
+
+    // wird einmalig in Nunchuk.cpp instanziiert
+    extern template class NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer>;
 }
+
+#include "NunchukImpl.h"
+
 #endif // !NUNCHUK_H
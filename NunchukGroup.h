@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef NUNCHUK_GROUP_H
+#define NUNCHUK_GROUP_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Nunchuk.h"
+
+namespace communication
+{
+
+/**
+ * @brief Klassen-Template einer Gruppe von Nunchuks, z. B. hinter einem I2C-Multiplexer.
+ * Die Geräte werden reihum abgefragt, pro Aufruf von read() findet höchstens eine
+ * Bustransaktion statt. Die Geräte sollten in aufsteigender Kanalreihenfolge hinzugefügt
+ * werden, die Auswahl eines Kanals deckt jeweils Auslesen und Registerzeiger ab.
+ *
+ * @tparam Size maximale Anzahl der Geräte
+ * @tparam Device Typ der Geräte, eine Konfiguration von NunchukT
+ */
+template<
+	size_t Size,
+	class Device = Nunchuk
+>
+class NunchukGroup
+{
+	public: // public static Member
+
+		// Messfenster der Abtastrate in ms
+		static constexpr const unsigned long RATE_WINDOW{1000};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der NunchukGroup Klasse
+		 */
+		NunchukGroup()
+		: m_devices{nullptr},
+		  m_count{0},
+		  m_next{0},
+		  m_samples{0},
+		  m_changes{0},
+		  m_windowStart{Clock::current()},
+		  m_rate{0},
+		  m_changeRate{0}
+		{
+
+		}
+
+		/**
+		 * @brief Fügt der Gruppe ein Gerät hinzu
+		 *
+		 * @param device Referenz auf das Gerät
+		 * @return true Gerät hinzugefügt
+		 * @return false Gruppe ist voll
+		 */
+		const bool add(Device &device)
+		{
+			if (m_count >= Size)
+			{
+				return false;
+			}
+
+			m_devices[m_count++] = &device;
+			return true;
+		}
+
+		/**
+		 * @brief Initialisiert alle Geräte der Gruppe
+		 *
+		 * @return size_t Anzahl der verbundenen Geräte
+		 */
+		size_t begin()
+		{
+			size_t connected = 0;
+
+			for (size_t i = 0; i < m_count; i++)
+			{
+				if (m_devices[i]->begin() == State::CONNECTED)
+				{
+					connected++;
+				}
+			}
+
+			return connected;
+		}
+
+		/**
+		 * @brief Fragt die Geräte reihum ab, bis eines eine Bustransaktion durchführt.
+		 * Geräte, deren Zykluszeit noch nicht abgelaufen ist, werden übersprungen.
+		 *
+		 * @return Device* Gerät mit neuen Daten, nullptr falls keine neuen Daten vorliegen
+		 */
+		Device *read()
+		{
+			updateRate();
+
+			for (size_t tries = 0; tries < m_count; tries++)
+			{
+				Device *device = m_devices[m_next];
+				m_next = (m_next + 1) % m_count;
+
+				const State state = device->read();
+
+				if (state == State::NO_DATA_AVAILABLE)
+				{
+					continue;
+				}
+
+				if (state == State::CONNECTED)
+				{
+					m_samples++;
+
+					// Transaktion mit unverändertem Datensatz hat stattgefunden
+					if (device->isDuplicate())
+					{
+						return nullptr;
+					}
+
+					m_changes++;
+					return device;
+				}
+
+				// fehlgeschlagene Transaktion, nächster Aufruf fährt mit dem nächsten Gerät fort
+				return nullptr;
+			}
+
+			return nullptr;
+		}
+
+		/**
+		 * @brief Gibt die Anzahl der Geräte in der Gruppe zurück
+		 *
+		 * @return size_t Anzahl der Geräte
+		 */
+		size_t size() const
+		{
+			return m_count;
+		}
+
+		/**
+		 * @brief Gibt das Gerät an der angegebenen Position zurück
+		 *
+		 * @param index Position in [0;size())
+		 * @return Device& Referenz auf das Gerät
+		 */
+		Device &operator[](const size_t index)
+		{
+			return *m_devices[index];
+		}
+
+		/**
+		 * @brief Gibt die Gesamtabtastrate aller Geräte des letzten vollständigen
+		 * Messfensters zurück. Gezählt werden alle erfolgreichen Transaktionen, auch solche
+		 * mit unverändertem Datensatz.
+		 *
+		 * @return uint16_t Datensätze pro Sekunde
+		 */
+		uint16_t samplesPerSecond() const
+		{
+			return m_rate;
+		}
+
+		/**
+		 * @brief Gibt die Anzahl geänderter Datensätze aller Geräte pro Sekunde im letzten
+		 * vollständigen Messfenster zurück, d. h. die Aufrufe von read(), die ein Gerät
+		 * zurückgegeben haben
+		 *
+		 * @return uint16_t geänderte Datensätze pro Sekunde
+		 */
+		uint16_t changesPerSecond() const
+		{
+			return m_changeRate;
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Schließt ggf. das aktuelle Messfenster ab und berechnet die Abtastrate
+		 */
+		void updateRate()
+		{
+			const unsigned long elapsed = (Clock::current() - m_windowStart) / 1000;
+
+			if (elapsed < RATE_WINDOW)
+			{
+				return;
+			}
+
+			m_rate = static_cast<uint16_t>((m_samples * 1000UL) / elapsed);
+			m_changeRate = static_cast<uint16_t>((m_changes * 1000UL) / elapsed);
+			m_samples = 0;
+			m_changes = 0;
+			m_windowStart += elapsed * 1000UL;
+		}
+
+	private: // private Member
+		Device *m_devices[Size]; // Geräte der Gruppe
+		size_t m_count; // Anzahl der Geräte
+		size_t m_next; // als nächstes abzufragendes Gerät
+		uint32_t m_samples; // erfolgreiche Transaktionen im aktuellen Messfenster
+		uint32_t m_changes; // geänderte Datensätze im aktuellen Messfenster
+		unsigned long m_windowStart; // Beginn des aktuellen Messfensters in µs
+		uint16_t m_rate; // Datensätze pro Sekunde im letzten Messfenster
+		uint16_t m_changeRate; // geänderte Datensätze pro Sekunde im letzten Messfenster
+};
+
+} // namespace communication
+
+#endif // !NUNCHUK_GROUP_H
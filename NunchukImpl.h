@@ -0,0 +1,1329 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   NunchukImpl.h
+ * 
+ * @brief  Implementierung des Klassen-Templates NunchukT, wird von Nunchuk.h eingebunden.
+ *         Verwendet die Bus-Policy zur Kommunikation mit dem Nunchuk.
+ * 
+ */
+
+#ifndef NUNCHUK_IMPL_H
+#define NUNCHUK_IMPL_H
+
+#include "Nunchuk.h"
+
+namespace communication
+{
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::NunchukT(const unsigned long buttonTimeout,
+      const unsigned long cycletime,
+      const ClockMode mode)
+        : m_bus {},
+        m_levelShifter {},
+        m_debounce {buttonTimeout, buttonTimeout, ButtonId::C, ButtonId::Z},
+        m_filter {},
+        m_timer {cycletime},
+        m_features {},
+        m_frame {},
+        m_state{ State::BEGIN },
+        m_invalidFrames { 0 },
+        m_duplicateFrames { 0 },
+        m_reconnect {},
+        m_pointerTime { 0 },
+        m_gap { Control::DELAY_REGISTER_US },
+        m_joystickXNull { Joystick::X_NULL },
+        m_joystickYNull { Joystick::Y_NULL },
+        m_deadzone { 0 },
+        m_warmStart { false },
+        m_encrypted { false },
+        m_invalidRun { 0 },
+        m_backoff { 0 },
+        m_pipelined { true },
+        m_gapMeasured { false },
+        m_duplicate { false }
+    {
+      m_bus.setClock(static_cast<uint32_t>(mode));
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::NunchukT(const uint8_t lvlshft,
+      const unsigned long buttonTimeout,
+      const unsigned long cycletime,
+      const ClockMode mode)
+        : NunchukT(lvlshft, buttonTimeout, buttonTimeout, cycletime, mode)
+    {}
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::NunchukT(const uint8_t lvlshft,
+      const unsigned long cTimeout, const unsigned long zTimeout,
+      const unsigned long cycletime,
+      const ClockMode mode)
+        : m_bus {},
+        m_levelShifter { lvlshft },
+        m_debounce {cTimeout, zTimeout, ButtonId::C, ButtonId::Z},
+        m_filter {},
+        m_timer {cycletime},
+        m_features {},
+        m_frame {},
+        m_state{ State::BEGIN },
+        m_invalidFrames { 0 },
+        m_duplicateFrames { 0 },
+        m_reconnect {},
+        m_pointerTime { 0 },
+        m_gap { Control::DELAY_REGISTER_US },
+        m_joystickXNull { Joystick::X_NULL },
+        m_joystickYNull { Joystick::Y_NULL },
+        m_deadzone { 0 },
+        m_warmStart { false },
+        m_encrypted { false },
+        m_invalidRun { 0 },
+        m_backoff { 0 },
+        m_pipelined { true },
+        m_gapMeasured { false },
+        m_duplicate { false }
+    {
+      m_bus.setClock(static_cast<uint32_t>(mode));
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::~NunchukT()
+    {
+      detach();
+      m_bus.end();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::isConnected() const
+    {
+        return m_state == State::CONNECTED;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const State NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::getState() const
+    {
+      return m_state;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const Frame NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::snapshot() const
+    {
+      return m_frame.read();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint32_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::snapshotRetries() const
+    {
+      return m_frame.retries();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::attach(BusScheduler &scheduler)
+    {
+      static_assert(Timer::ENABLED, "Der BusScheduler erfordert die Policy CycleTimer");
+      return m_timer.attach(scheduler);
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::detach()
+    {
+      if constexpr (Timer::ENABLED)
+      {
+        m_timer.detach();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    State NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::begin()
+    {
+      const TraceSpan span{TracePoint::BEGIN};
+
+      serialverbose("Nunchuk-Initialisierung gestartet.");
+
+      if constexpr (has<ProfileSupport>())
+      {
+        feature<ProfileSupport>().unload();
+      }
+
+      // Initialisierungssequenz
+      m_bus.begin();
+      enable();
+
+      if (!select())
+      {
+        serialerror("Kanal des Multiplexers nicht erreichbar.", State::NOT_CONNECTED);
+        m_state = State::NOT_CONNECTED;
+        disable();
+        return m_state;
+      }
+
+      Clock::tick();
+      if constexpr (has<StartupTiming>())
+      {
+        feature<StartupTiming>().start(Clock::now());
+      }
+      m_invalidRun = 0;
+
+      // Gesten nicht über einen Verbindungsaufbau hinweg fortsetzen
+      if constexpr (has<GestureSupport>())
+      {
+        feature<GestureSupport>().reset();
+      }
+
+      // Warmstart, falls das Gerät noch initialisiert ist
+      m_warmStart = probe();
+      if (m_warmStart)
+      {
+        serialinfo("Nunchuk bereits initialisiert, Initialisierung übersprungen.");
+        m_state = State::CONNECTED;
+      }
+      else
+      {
+        m_state = initialize();
+      }
+
+      // alle Originalgeräte melden dieselbe ID, erst die Kalibrierungsdaten unterscheiden sie;
+      // das Profil wird mit einem Lesezugriff geladen
+      bool calibrated = false;
+      uint16_t storedGap = 0;
+      if constexpr (has<ProfileSupport>())
+      {
+        calibrated = m_state == State::CONNECTED && feature<ProfileSupport>().attached() && readCalibration();
+        if (calibrated && feature<ProfileSupport>().restore(m_joystickXNull, m_joystickYNull, m_deadzone, storedGap))
+        {
+          serialinfo("Profil geladen.");
+
+          // gespeicherten Mindestabstand übernehmen, damit ein Warmstart nicht erneut misst
+          if (!m_gapMeasured && storedGap > 0)
+          {
+            m_gap = storedGap;
+            m_gapMeasured = true;
+          }
+
+          if constexpr (has<AutoCenterSupport>())
+          {
+            feature<AutoCenterSupport>().reset(m_joystickXNull, m_joystickYNull);
+          }
+        }
+      }
+
+      // Mindestabstand einmalig messen, nicht bei jedem erneuten Verbindungsaufbau; danach
+      // steht der Registerzeiger in jedem Fall auf den Sensordaten
+      if (m_state == State::CONNECTED)
+      {
+        if (!m_gapMeasured)
+        {
+          measureConversionGap();
+        }
+        else
+        {
+          writePointer();
+        }
+      }
+
+      // neues Gerät oder neu gemessener Mindestabstand (0: nicht gemessen, wie in saveProfile())
+      if (calibrated && (!hasProfile() || storedGap != (m_gapMeasured ? m_gap : 0)))
+      {
+        saveProfile();
+      }
+
+      disable();
+      return m_state;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const State NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::initialize()
+    {
+      const TraceSpan span{TracePoint::INITIALIZE};
+
+      m_encrypted = false;
+
+      // unverschlüsselter Modus, sofern das Gerät ihn unterstützt
+      const uint8_t result = initializePlain();
+      if (result == WireReturnCode::SUCCESS && readId(false))
+      {
+        serialinfo("Nunchuk-Initalisierung erfolgreich.");
+        return State::CONNECTED;
+      }
+
+      // ältere Geräte und Nachbauten nur im verschlüsselten Modus
+      const uint8_t resultEncrypted = initializeEncrypted();
+      if (resultEncrypted == WireReturnCode::SUCCESS && readId(true))
+      {
+        serialinfo("Nunchuk-Initalisierung im verschlüsselten Modus erfolgreich.");
+        m_encrypted = true;
+        return State::CONNECTED;
+      }
+
+      State state = State::NOT_CONNECTED;
+
+      // keine ID erkannt: Geräte mit abweichender ID wie bisher unverschlüsselt betreiben,
+      // sonst den Übertragungsfehler der ersten fehlgeschlagenen Initialisierung auswerten
+      const uint8_t error = (result != WireReturnCode::SUCCESS) ? result : resultEncrypted;
+      switch ((error == WireReturnCode::SUCCESS) ? initializePlain() : error)
+      {
+      case WireReturnCode::SUCCESS:
+      {
+        uint8_t id[Control::LEN_ID];
+        if (!readRegister(Control::REG_ID, id, Control::LEN_ID))
+        {
+          serialerror("ID konnte nicht gelesen werden.", State::NOT_CONNECTED);
+          break;
+        }
+
+        // ein bereits verschlüsselt initialisiertes Gerät ignoriert die unverschlüsselte
+        // Initialisierung, z. B. wenn nur das Lesen der ID gestört war
+        m_encrypted = true;
+        for (uint8_t i = 0; i < Control::LEN_ID; i++)
+        {
+          m_encrypted = m_encrypted && (Encryption::decrypt(id[i]) == Control::ID_NUNCHUK[i]);
+        }
+
+        if (m_encrypted)
+        {
+          storeId(Control::ID_NUNCHUK);
+          serialinfo("Nunchuk-Initalisierung im verschlüsselten Modus erfolgreich.");
+        }
+        else
+        {
+          storeId(id);
+          serialinfo("Nunchuk-Initalisierung erfolgreich, unbekannte ID.");
+        }
+        state = State::CONNECTED;
+        break;
+      }
+
+      case WireReturnCode::DATA_TOO_LONG:
+        serialerror("Übertragungsfehler: Zu viele Daten für Übertragungspuffer.", State::BAD_VALUE);
+        state = State::BAD_VALUE;
+        [[fallthrough]];
+
+      case WireReturnCode::NACK_ON_ADDR:
+        serialerror("Übertragungsfehler: NACK erhalten bei Übertragung der Adresse.", State::BAD_VALUE);
+        state = State::BAD_VALUE;
+        [[fallthrough]];
+        
+      case WireReturnCode::NACK_ON_DATA:
+        serialerror("Übertragungsfehler: NACK erhalten bei Übertragung der Daten.", State::BAD_VALUE);
+        state = State::BAD_VALUE;
+        [[fallthrough]];
+
+      case WireReturnCode::OTHER:
+        serialerror("Übertragungsfehler: Allgemeiner Fehler.", State::ERROR_OCCURED);
+        state = State::ERROR_OCCURED;
+        [[fallthrough]];
+
+      case WireReturnCode::TIMEOUT:
+        serialerror("Übertragungsfehler: Nunchuk braucht zu lange zum Antworten.", State::TIMEOUT);
+        state = State::TIMEOUT;
+        [[fallthrough]];
+
+      default:
+        state = State::NOT_CONNECTED;
+        break;
+      }
+      return state;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint8_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::initializePlain()
+    {
+      m_bus.beginTransmission(Control::ADDR_NUNCHUK);
+      // erstes Initialisierungsregister
+      m_bus.write(static_cast<uint8_t>(0xF0));
+      // auf ersten Initialisierungswert setzen
+      m_bus.write(static_cast<uint8_t>(0x55));
+      m_bus.endTransmission(true);
+
+      delay(1);
+
+      m_bus.beginTransmission(Control::ADDR_NUNCHUK);
+      // zweites Initialisierungsregister
+      m_bus.write(static_cast<uint8_t>(0xFB));
+      // auf zweiten Initialisierungswert setzen
+      m_bus.write(static_cast<uint8_t>(0x00));
+      return m_bus.endTransmission(true);
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint8_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::initializeEncrypted()
+    {
+      m_bus.beginTransmission(Control::ADDR_NUNCHUK);
+      m_bus.write(Encryption::REG_INIT);
+      m_bus.write(Encryption::VAL_INIT);
+      const uint8_t result = m_bus.endTransmission(true);
+
+      delay(1);
+      return result;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::readId(const bool encrypted)
+    {
+      // readRegister() entschlüsselt nur im bereits erkannten Modus
+      uint8_t id[Control::LEN_ID];
+      const bool previous = m_encrypted;
+      m_encrypted = encrypted;
+      const bool success = readRegister(Control::REG_ID, id, Control::LEN_ID);
+      m_encrypted = previous;
+
+      if (success)
+      {
+        storeId(id);
+      }
+      return success && memcmp(id, Control::ID_NUNCHUK, Control::LEN_ID) == 0;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    State NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::read()
+    {
+      const TraceSpan span{TracePoint::READ};
+
+      // alle Zeitgeber dieses Aufrufs beziehen sich auf denselben Zeitpunkt
+      Clock::tick();
+
+      // Frist des Failsafe unabhängig davon prüfen, ob in diesem Aufruf gelesen wird
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (feature<FailsafeSupport>().check())
+        {
+          neutralize();
+        }
+      }
+
+      switch (m_state)
+      {
+      case State::CONNECTED:
+        // erst lesen, wenn der Scheduler den Bus freigibt bzw. die Zykluszeit vorbei ist
+        if (!m_timer.due())
+        {
+          // Haltezeit und Doppelklickfenster laufen auch zwischen den Abfragen ab
+          updateGestures();
+          return State::NO_DATA_AVAILABLE;
+        }
+
+        // Rohdaten vom Gerät anfordern
+        enable();
+
+        if (!select())
+        {
+          m_state = State::NOT_CONNECTED;
+          serialerror("Kanal des Multiplexers nicht erreichbar.", m_state);
+          disable();
+          supervise(false);
+          return m_state;
+        }
+
+        // im Pipeline-Betrieb wurde der Registerzeiger bereits nach der letzten Abfrage gesetzt,
+        // sonst jetzt; in beiden Fällen mindestens den gemessenen Abstand bis zum Lesen einhalten
+        if (!m_pipelined)
+        {
+          const TraceSpan pointer{TracePoint::WRITE_POINTER};
+          writePointer();
+        }
+        awaitConversion();
+
+        uint8_t length;
+        {
+          TraceSpan request{TracePoint::REQUEST_FROM};
+          length = m_bus.requestFrom(Control::ADDR_NUNCHUK, Control::LEN_RAW_DATA);
+          request.setArg(length);
+        }
+
+        if (length != Control::LEN_RAW_DATA)
+        {
+  
+            // falls Fehler bei der Kommunikation, das Gerät als getrennt markieren und mit
+            // Fehler zurückkehren
+            m_state = State::NOT_CONNECTED;
+            serialerror("Übertragung fehlgeschlagen.", m_state);
+        }
+
+        if constexpr (debugmode > 1)
+        {
+          auto msg = String("Anzahl der verfügbaren Bytes: ");
+          msg += String(m_bus.available());
+          serialverbose(msg.c_str());
+        }
+
+        // empfangene Daten in den inaktiven Puffer auslesen und nur vollständige, plausible und
+        // veränderte Datensätze veröffentlichen
+        {
+          Frame &next = m_frame.back();
+          uint8_t received = 0;
+          bool published = false;
+          bool rejected = false;
+
+          {
+            const TraceSpan receive{TracePoint::RECEIVE};
+            for (; (received < Control::LEN_RAW_DATA) && m_bus.available(); received++)
+            {
+                // im verschlüsselten Modus ein Tabellenzugriff je Byte
+                next.raw[received] = m_encrypted ? Encryption::decrypt(m_bus.read()) : m_bus.read();
+            }
+          }
+
+          if (received == Control::LEN_RAW_DATA)
+          {
+            if (!next.isPlausible())
+            {
+              // z. B. halb gestecktes Kabel
+              m_invalidFrames++;
+              rejected = true;
+
+              // dauerhaft ungültige Datensätze liefert ein Gerät, das seine Initialisierung
+              // verloren hat, daher neu verbinden
+              if (++m_invalidRun >= Control::MAX_INVALID_FRAMES)
+              {
+                m_state = State::NOT_CONNECTED;
+                serialerror("Wiederholt ungültige Datensätze empfangen.", m_state);
+              }
+            }
+            else if (next == m_frame.front())
+            {
+              // unveränderter Datensatz, Dekodierung und Filter entfallen, sofern der Filter
+              // nicht auf gleichmäßige Abtastung angewiesen ist
+              m_duplicateFrames++;
+
+              if constexpr (Filter::DUPLICATES)
+              {
+                const TraceSpan filter{TracePoint::FILTER};
+                m_filter.update(next.decodeAccelerationX(), next.decodeAccelerationY(),
+                  next.decodeAccelerationZ());
+              }
+            }
+            else
+            {
+              m_frame.publish();
+              published = true;
+
+              if constexpr (has<StartupTiming>())
+              {
+                feature<StartupTiming>().sample(Clock::now());
+              }
+
+              const TraceSpan filter{TracePoint::FILTER};
+              m_filter.update(next.decodeAccelerationX(), next.decodeAccelerationY(),
+                next.decodeAccelerationZ());
+            }
+
+            if (!rejected)
+            {
+              m_invalidRun = 0;
+            }
+          }
+          m_duplicate = (received == Control::LEN_RAW_DATA) && !rejected && !published;
+
+          // jeder vollständige, plausible Datensatz gilt als frisch, auch ein unveränderter;
+          // vor der Entprellung, damit diese nach dem Auslösen den neutralen Datensatz sieht
+          supervise((received == Control::LEN_RAW_DATA) && !rejected);
+
+          // Wandlung des nächsten Datensatzes anstoßen
+          if (m_pipelined)
+          {
+            const TraceSpan pointer{TracePoint::WRITE_POINTER};
+            writePointer();
+          }
+
+          disable();
+
+          // die Entprellung läuft auch bei unveränderten Datensätzen weiter, da sie zeitabhängig ist
+          if (!rejected)
+          {
+            const Frame &current = m_frame.front();
+            {
+              const TraceSpan debounce{TracePoint::DEBOUNCE};
+              m_debounce.update(current.decodeButtonC(), current.decodeButtonZ());
+            }
+
+            // Mittenwerte bei losgelassenem Joystick nachführen, auch unveränderte Datensätze
+            // zählen als Ruhe
+            if constexpr (has<AutoCenterSupport>())
+            {
+              feature<AutoCenterSupport>().update(current.raw[0], current.raw[1],
+                current.decodeButtonC() || current.decodeButtonZ(), m_joystickXNull, m_joystickYNull);
+            }
+
+            updateGestures();
+          }
+
+          // neue Datensätze einmal dekodieren und an die fälligen Abonnenten verteilen
+          if (published)
+          {
+            distribute();
+          }
+
+          // ggf. Rohdaten ausgeben
+          if constexpr (debugmode > 0)
+          {
+            if (published)
+            {
+              serialinfo("Rohdaten:");
+              const Frame &current = m_frame.front();
+              for (uint8_t i = 0; i < Control::LEN_RAW_DATA; i++)
+              {
+                Serial.print(current.raw[i], HEX);
+                Serial.print(" ");
+              }
+              Serial.println();
+            }
+          }
+
+          if (m_state == State::CONNECTED)
+          {
+            if (rejected)
+            {
+              return State::BAD_VALUE;
+            }
+
+            // unvollständig empfangen, es liegt kein Datensatz vor; ein unveränderter
+            // Datensatz gilt dagegen als gültig, siehe isDuplicate()
+            if (received != Control::LEN_RAW_DATA)
+            {
+              return State::NO_DATA_AVAILABLE;
+            }
+          }
+        }
+        break;
+
+      case State::NOT_CONNECTED:
+        // nach einem Fehlschlag den Bus bis zum Ablauf der Wartezeit nicht belegen
+        if (m_reconnect.pending())
+        {
+          return m_state;
+        }
+
+        // Falls das Gerät nicht verbunden/initialisiert ist zweimal versuchen, sonst mit Fehler
+        // zurückkehren
+        for (int i = 1; i <= 3; i++)
+        {
+          begin();
+          
+          if (m_state == State::CONNECTED)
+          {
+            serialinfo("Nunchuk bereit zur Kommunikation");
+            break;
+          }
+          else
+          {
+            serialerror("Verbindungsaufbau nach 3 Versuchen fehlgeschlagen.", m_state);
+          }
+        }
+
+        // nach dem Verbindungsaufbau liegt noch kein neuer Datensatz vor, erst der nächste
+        // Aufruf liest
+        if (m_state == State::CONNECTED)
+        {
+          m_reconnect.stop();
+          m_backoff = 0;
+          return State::NO_DATA_AVAILABLE;
+        }
+
+        // ohne Verbindung nach exponentiell wachsender Wartezeit erneut versuchen
+        {
+          const unsigned long backoff = Control::RECONNECT_MIN_US << m_backoff;
+          if (backoff < Control::RECONNECT_MAX_US)
+          {
+            m_reconnect.start(backoff);
+            m_backoff++;
+          }
+          else
+          {
+            m_reconnect.start(Control::RECONNECT_MAX_US);
+          }
+        }
+        return m_state;
+
+      default:
+        m_state = State::ERROR_OCCURED;
+        break;
+      }
+
+      return m_state;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint32_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::invalidFrames() const
+    {
+      return m_invalidFrames;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint32_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::duplicateFrames() const
+    {
+      return m_duplicateFrames;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::isDuplicate() const
+    {
+      return m_duplicate;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::isEncrypted() const
+    {
+      return m_encrypted;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::isWarmStart() const
+    {
+      return m_warmStart;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const unsigned long NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::timeToFirstSample() const
+    {
+      if constexpr (has<StartupTiming>())
+      {
+        return feature<StartupTiming>().elapsed();
+      }
+      else
+      {
+        return 0;
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const unsigned long NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::timeUntilNextEvent() const
+    {
+      // ab dem aktuellen Zeitpunkt, seit dem letzten Abtasten kann bereits Zeit vergangen sein
+      const unsigned long now = Clock::current();
+
+      // ohne Verbindung laufen Zyklus und Entprellung nicht weiter, nur der Verbindungsaufbau
+      // steht an
+      if (m_state == State::NOT_CONNECTED)
+      {
+        return m_reconnect.armed() ? m_reconnect.remaining(now) : 0;
+      }
+
+      // jeder Zeitgeber hat einen festen Platz, ohne Policy entfällt er
+      unsigned long next = m_reconnect.remaining(now);
+
+      if constexpr (Timer::ENABLED)
+      {
+        next = earliest(next, m_timer.deadline(), now);
+      }
+
+      if constexpr (Debounce::ENABLED)
+      {
+        next = earliest(next, m_debounce.buttonC().deadline(), now);
+        next = earliest(next, m_debounce.buttonZ().deadline(), now);
+      }
+
+      if constexpr (has<GestureSupport>())
+      {
+        if (const Deadline *const deadline = feature<GestureSupport>().deadline())
+        {
+          next = earliest(next, *deadline, now);
+        }
+      }
+
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (const Deadline *const deadline = feature<FailsafeSupport>().deadline())
+        {
+          next = earliest(next, *deadline, now);
+        }
+      }
+
+      return next;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const unsigned long NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::earliest(const unsigned long next,
+      const Deadline &deadline, const unsigned long now)
+    {
+      const unsigned long remaining = deadline.remaining(now);
+      return (remaining < next) ? remaining : next;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::pressedC() const
+    {
+      if constexpr (Debounce::ENABLED)
+      {
+        return m_debounce.buttonC().isPressed();
+      }
+      else
+      {
+        return decodeButtonC();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::pressedZ() const
+    {
+      if constexpr (Debounce::ENABLED)
+      {
+        return m_debounce.buttonZ().isPressed();
+      }
+      else
+      {
+        return decodeButtonZ();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeButtonZ() const
+    {
+        return snapshot().decodeButtonZ();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeButtonC() const
+    {
+        return snapshot().decodeButtonC();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeAccelerationX() const
+    {
+        return snapshot().decodeAccelerationX();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeAccelerationY() const
+    {
+        return snapshot().decodeAccelerationY();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeAccelerationZ() const
+    {
+        return snapshot().decodeAccelerationZ();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeJoystickX() const
+    {
+        return joystickX(snapshot());
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::decodeJoystickY() const
+    {
+        return joystickY(snapshot());
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::filteredAccelerationX() const
+    {
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (feature<FailsafeSupport>().engaged())
+        {
+          return 0;
+        }
+      }
+
+      if constexpr (Filter::ENABLED)
+      {
+        return m_filter.accelerationX();
+      }
+      else
+      {
+        return decodeAccelerationX();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::filteredAccelerationY() const
+    {
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (feature<FailsafeSupport>().engaged())
+        {
+          return 0;
+        }
+      }
+
+      if constexpr (Filter::ENABLED)
+      {
+        return m_filter.accelerationY();
+      }
+      else
+      {
+        return decodeAccelerationY();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::filteredAccelerationZ() const
+    {
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (feature<FailsafeSupport>().engaged())
+        {
+          return 0;
+        }
+      }
+
+      if constexpr (Filter::ENABLED)
+      {
+        return m_filter.accelerationZ();
+      }
+      else
+      {
+        return decodeAccelerationZ();
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::print()
+    {
+      const TraceSpan span{TracePoint::PRINT};
+
+      if (!isConnected())
+      {
+        m_state = State::NO_DATA_AVAILABLE;
+        serialerror("Es liegen keine neuen Sensorendaten vor.", m_state);
+        return;
+      }
+      
+      // alle Werte aus demselben Datensatz ausgeben
+      const Frame current = snapshot();
+
+      Serial.print("\nDaten (dezimale Werte)\n\n");
+      Serial.print("Joystick:\t\t\tX = ");
+      Serial.print(joystickX(current), DEC);
+      Serial.print("\tY = ");
+      Serial.print(joystickY(current), DEC);
+      Serial.println();
+      Serial.print("Beschleunigung:\tX = ");
+      Serial.print(current.decodeAccelerationX(), DEC);
+      Serial.print("\tY = ");
+      Serial.print(current.decodeAccelerationY(), DEC);
+      Serial.print("\tZ = ");
+      Serial.print(current.decodeAccelerationZ(), DEC);
+      Serial.println();
+      Serial.print("Buttons:\n\tC = ");
+      Serial.print(current.decodeButtonC() ? "gedrückt" : "nicht gedrückt");
+      Serial.println();
+      Serial.print("\tZ = ");
+      Serial.print(current.decodeButtonZ() ? "gedrückt" : "nicht gedrückt");
+      Serial.println();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::enable() const
+    {
+      const TraceSpan span{TracePoint::ENABLE};
+
+      if constexpr (LevelShifterPolicy::ENABLED)
+      {
+        serialverbose("Pegelwandler aktiviert.");
+      }
+
+      m_levelShifter.enable();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::disable() const
+    {
+      const TraceSpan span{TracePoint::DISABLE};
+
+      if constexpr (LevelShifterPolicy::ENABLED)
+      {
+        serialverbose("Pegelwandler deaktiviert.");
+      }
+
+      m_levelShifter.disable();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::select()
+    {
+      const TraceSpan span{TracePoint::SELECT};
+
+      if constexpr (has<MultiplexerSupport>())
+      {
+        return feature<MultiplexerSupport>().select(m_bus);
+      }
+
+      return true;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::readRegister(const uint8_t reg, uint8_t *data, const uint8_t length)
+    {
+      m_bus.beginTransmission(Control::ADDR_NUNCHUK);
+      m_bus.write(reg);
+      if (m_bus.endTransmission(true) != WireReturnCode::SUCCESS)
+      {
+        return false;
+      }
+
+      delayMicroseconds(Control::DELAY_REGISTER_US);
+
+      if (m_bus.requestFrom(Control::ADDR_NUNCHUK, length) != length)
+      {
+        return false;
+      }
+
+      for (uint8_t i = 0; i < length; i++)
+      {
+        data[i] = m_encrypted ? Encryption::decrypt(m_bus.read()) : m_bus.read();
+      }
+
+      return true;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::writePointer()
+    {
+      m_bus.beginTransmission(Control::ADDR_NUNCHUK);
+      m_bus.write(Control::REG_RAW_DATA);
+      const bool success = m_bus.endTransmission(true) == WireReturnCode::SUCCESS;
+      m_pointerTime = Clock::current();
+      return success;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::awaitConversion() const
+    {
+      const TraceSpan span{TracePoint::AWAIT_CONVERSION};
+
+      const unsigned long elapsed = Clock::current() - m_pointerTime;
+      if (elapsed < m_gap)
+      {
+        delayMicroseconds(static_cast<unsigned int>(m_gap - elapsed));
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::sampleFrame(const unsigned long gap, Frame &frame)
+    {
+      if (!writePointer())
+      {
+        return false;
+      }
+
+      delayMicroseconds(static_cast<unsigned int>(gap));
+
+      if (m_bus.requestFrom(Control::ADDR_NUNCHUK, Control::LEN_RAW_DATA) != Control::LEN_RAW_DATA)
+      {
+        return false;
+      }
+
+      for (uint8_t i = 0; i < Control::LEN_RAW_DATA; i++)
+      {
+        frame.raw[i] = m_encrypted ? Encryption::decrypt(m_bus.read()) : m_bus.read();
+      }
+
+      return true;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::measureConversionGap()
+    {
+      const TraceSpan span{TracePoint::MEASURE_GAP};
+
+      Frame reference;
+      Frame trial;
+      uint8_t duplicates = 0;
+
+      // liefert das Gerät schon bei sicherem Abstand nur gleiche Datensätze (ohne Rauschen),
+      // sind veraltete Datensätze nicht von neuen zu unterscheiden
+      bool measured = sampleFrame(Control::GAP_REFERENCE_US, reference);
+      for (uint8_t i = 0; measured && i < Control::GAP_TRIALS; i++)
+      {
+        measured = sampleFrame(Control::GAP_REFERENCE_US, trial);
+        duplicates += (trial == reference) ? 1 : 0;
+        reference = trial;
+      }
+      const bool detectStale = duplicates < Control::GAP_TRIALS;
+
+      unsigned long gap = Control::GAP_REFERENCE_US;
+      for (uint8_t c = 0; measured && detectStale && c < sizeof(Control::GAP_CANDIDATES_US) / sizeof(Control::GAP_CANDIDATES_US[0]); c++)
+      {
+        bool safe = true;
+        uint8_t stale = 0;
+
+        // je Versuch ein Referenzdatensatz mit sicherem Abstand, ein veralteter Datensatz
+        // wiederholt ihn; eine einzelne Wiederholung kann auch zufällig (Rauschen) auftreten
+        for (uint8_t i = 0; measured && safe && i < Control::GAP_TRIALS; i++)
+        {
+          measured = sampleFrame(Control::GAP_REFERENCE_US, reference)
+            && sampleFrame(Control::GAP_CANDIDATES_US[c], trial);
+          stale += (trial == reference) ? 1 : 0;
+          safe = trial.isPlausible() && stale < 2;
+        }
+
+        if (measured && safe)
+        {
+          gap = Control::GAP_CANDIDATES_US[c];
+          break;
+        }
+      }
+
+      if (measured && detectStale)
+      {
+        m_gap = static_cast<uint16_t>(gap + gap / 4);
+        m_gapMeasured = true;
+      }
+      else if (measured)
+      {
+        // ohne erkennbare veraltete Datensätze ist kein kürzerer Abstand belegbar, sicheren
+        // Standardwert verwenden und weder als gemessen übernehmen noch speichern
+        m_gap = Control::DELAY_REGISTER_US;
+        m_gapMeasured = false;
+      }
+
+      // Wandlung für den ersten Zyklus anstoßen
+      writePointer();
+      return measured && detectStale;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const unsigned long NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::tuneConversionGap()
+    {
+      enable();
+      const bool measured = select() && measureConversionGap();
+      disable();
+
+      if (measured)
+      {
+        saveProfile();
+      }
+      return m_gap;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const unsigned long NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::conversionGap() const
+    {
+      return m_gap;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::setPipelined(const bool pipelined)
+    {
+      m_pipelined = pipelined;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::isPipelined() const
+    {
+      return m_pipelined;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::probe()
+    {
+      const TraceSpan span{TracePoint::PROBE};
+
+      // ein nicht initialisiertes Gerät liefert keine gültige ID, weder unverschlüsselt noch
+      // verschlüsselt
+      if (readId(false))
+      {
+        m_encrypted = false;
+      }
+      else if (readId(true))
+      {
+        m_encrypted = true;
+      }
+      else
+      {
+        return false;
+      }
+
+      // Registerzeiger für den ersten Zyklus auf die Sensordaten setzen
+      return writePointer();
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::hasProfile() const
+    {
+      if constexpr (has<ProfileSupport>())
+      {
+        return feature<ProfileSupport>().loaded();
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::calibrate()
+    {
+      enable();
+
+      bool success = select() && readCalibration();
+
+      disable();
+
+      if constexpr (has<ProfileSupport>())
+      {
+        if (success && feature<ProfileSupport>().attached())
+        {
+          success = saveProfile();
+        }
+      }
+
+      return success;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::saveProfile()
+    {
+      if constexpr (has<ProfileSupport>())
+      {
+        return feature<ProfileSupport>().store(m_joystickXNull, m_joystickYNull, m_deadzone,
+          m_gapMeasured ? m_gap : 0);
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::setDeadzone(const uint8_t deadzone)
+    {
+      m_deadzone = deadzone;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint8_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::joystickCenterX() const
+    {
+      return m_joystickXNull;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const uint8_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::joystickCenterY() const
+    {
+      return m_joystickYNull;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const bool NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::readCalibration()
+    {
+      const TraceSpan span{TracePoint::CALIBRATE};
+
+      uint8_t cal[Control::LEN_CAL_DATA];
+
+      if (!readRegister(Control::REG_CAL_DATA, cal, Control::LEN_CAL_DATA))
+      {
+        serialerror("Kalibrierungsdaten konnten nicht gelesen werden.", State::NOT_CONNECTED);
+        return false;
+      }
+
+      // die beiden letzten Bytes sind die Prüfsumme der ersten 14 Bytes zzgl. 0x55 bzw. 0xAA
+      uint8_t sum = 0;
+      for (uint8_t i = 0; i < Control::LEN_CAL_DATA - 2; i++)
+      {
+        sum += cal[i];
+      }
+
+      if (static_cast<uint8_t>(sum + 0x55) != cal[Control::LEN_CAL_DATA - 2]
+        || static_cast<uint8_t>(sum + 0xAA) != cal[Control::LEN_CAL_DATA - 1])
+      {
+        serialerror("Ungültige Prüfsumme der Kalibrierungsdaten.", State::BAD_VALUE);
+        return false;
+      }
+
+      m_joystickXNull = cal[Control::CAL_JOYSTICK_X_NULL];
+      m_joystickYNull = cal[Control::CAL_JOYSTICK_Y_NULL];
+      if constexpr (has<ProfileSupport>())
+      {
+        feature<ProfileSupport>().setCalibration(cal, Control::LEN_CAL_DATA);
+      }
+
+      if constexpr (has<AutoCenterSupport>())
+      {
+        feature<AutoCenterSupport>().reset(m_joystickXNull, m_joystickYNull);
+      }
+      return true;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::joystickX(const Frame &frame) const
+    {
+      return applyDeadzone(frame.decodeJoystickX(m_joystickXNull));
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::joystickY(const Frame &frame) const
+    {
+      return applyDeadzone(frame.decodeJoystickY(m_joystickYNull));
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::distribute(const bool all)
+    {
+      if constexpr (has<PublisherSupport>())
+      {
+        if (feature<PublisherSupport>().attached())
+        {
+          const TraceSpan span{TracePoint::DISTRIBUTE};
+          feature<PublisherSupport>().distribute(*this, all);
+        }
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::updateGestures()
+    {
+      if constexpr (has<GestureSupport>())
+      {
+        if (feature<GestureSupport>().attached())
+        {
+          const TraceSpan span{TracePoint::GESTURES};
+          feature<GestureSupport>().update(pressedC(), pressedZ());
+        }
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::supervise(const bool fresh)
+    {
+      if constexpr (has<FailsafeSupport>())
+      {
+        if (fresh)
+        {
+          feature<FailsafeSupport>().feed();
+        }
+        else if ((m_state != State::CONNECTED) && feature<FailsafeSupport>().disconnected())
+        {
+          neutralize();
+        }
+      }
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::neutralize()
+    {
+      m_frame.write(Frame::neutral(m_joystickXNull, m_joystickYNull));
+      m_debounce.release();
+
+      if constexpr (has<GestureSupport>())
+      {
+        feature<GestureSupport>().reset();
+      }
+
+      // alle Abonnenten erhalten den neutralen Datensatz, unabhängig von ihrem Teiler
+      distribute(true);
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    const int16_t NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::applyDeadzone(const int16_t value) const
+    {
+      return (value <= m_deadzone && value >= -m_deadzone) ? 0 : value;
+    }
+
+    template<class Bus, class LevelShifterPolicy, class Debounce, class Filter, class Timer, class... Features>
+    void NunchukT<Bus, LevelShifterPolicy, Debounce, Filter, Timer, Features...>::storeId(const uint8_t *id)
+    {
+      if constexpr (has<ProfileSupport>())
+      {
+        feature<ProfileSupport>().setId(id);
+      }
+    }
+}
+
+#endif // !NUNCHUK_IMPL_H
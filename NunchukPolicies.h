@@ -0,0 +1,690 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   NunchukPolicies.h
+ *
+ * @brief  Policies, mit denen NunchukT zur Übersetzungszeit konfiguriert wird.
+ *         Nicht benötigte Funktionen belegen damit weder RAM noch Flash.
+ */
+
+#ifndef NUNCHUK_POLICIES_H
+#define NUNCHUK_POLICIES_H
+
+#include <Arduino.h>
+
+#include "Button.h"
+#include "BusScheduler.h"
+#include "Clock.h"
+#include "MovingAverage.h"
+#include "MovingMedian.h"
+#include "WireBus.h"
+
+namespace communication
+{
+    /************************
+     * Pegelwandler-Policies *
+     ************************/
+
+    /**
+     * @brief   Kein Pegelwandler vorhanden, Aktivieren und Deaktivieren entfallen.
+     */
+    class NoLevelShifter
+    {
+    public:
+        static constexpr const bool ENABLED{false};
+
+        NoLevelShifter() {}
+        NoLevelShifter(const uint8_t) {}
+
+        void enable() const {}
+        void disable() const {}
+    };
+
+    /**
+     * @brief   Pegelwandler mit Enable-Pin, der immer vorhanden ist.
+     */
+    class LevelShifter
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        /**
+         * @param pin Enable-Pin des Pegelwandlers
+         */
+        LevelShifter(const uint8_t pin)
+            : m_pin{pin}
+        {
+            pinMode(m_pin, OUTPUT);
+            digitalWrite(m_pin, LOW);
+        }
+
+        void enable() const
+        {
+            digitalWrite(m_pin, HIGH);
+            delayMicroseconds(500);
+        }
+
+        void disable() const
+        {
+            digitalWrite(m_pin, LOW);
+            delayMicroseconds(500);
+        }
+
+    private:
+        const uint8_t m_pin; // Enable-Pin des Pegelwandlers
+    };
+
+    /**
+     * @brief   Pegelwandler, dessen Vorhandensein erst zur Laufzeit feststeht.
+     *          Ohne Pin (NO_PIN) entfallen Aktivieren und Deaktivieren.
+     */
+    class OptionalLevelShifter
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        // kein Pegelwandler angeschlossen
+        static constexpr const uint8_t NO_PIN{0xFF};
+
+        OptionalLevelShifter()
+            : m_pin{NO_PIN}
+        {}
+
+        /**
+         * @param pin Enable-Pin des Pegelwandlers
+         */
+        OptionalLevelShifter(const uint8_t pin)
+            : m_pin{pin}
+        {
+            if (m_pin == NO_PIN)
+                return;
+
+            pinMode(m_pin, OUTPUT);
+            digitalWrite(m_pin, LOW);
+        }
+
+        void enable() const
+        {
+            if (m_pin == NO_PIN)
+                return;
+
+            digitalWrite(m_pin, HIGH);
+            delayMicroseconds(500);
+        }
+
+        void disable() const
+        {
+            if (m_pin == NO_PIN)
+                return;
+
+            digitalWrite(m_pin, LOW);
+            delayMicroseconds(500);
+        }
+
+    private:
+        const uint8_t m_pin; // Enable-Pin des Pegelwandlers
+    };
+
+    /***********************
+     * Entprell-Policies *
+     ***********************/
+
+    /**
+     * @brief   Keine Entprellung, die Buttons werden direkt aus dem Datensatz gelesen.
+     *          Callbacks und Ereignisse stehen nicht zur Verfügung.
+     */
+    class NoDebounce
+    {
+    public:
+        static constexpr const bool ENABLED{false};
+
+        NoDebounce(const unsigned long, const unsigned long, const uint8_t = 0, const uint8_t = 1) {}
+
+        void update(const bool, const bool) {}
+
+        void release() {}
+    };
+
+    /**
+     * @brief   Entprellung beider Buttons mit je einer eigenen Zeitspanne.
+     */
+    class ButtonDebounce
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        /**
+         * @param cTimeout Dauer bis der Zustand des C-Buttons angepasst wird in ms
+         * @param zTimeout Dauer bis der Zustand des Z-Buttons angepasst wird in ms
+         * @param cId Kennung des C-Buttons in Ereignissen
+         * @param zId Kennung des Z-Buttons in Ereignissen
+         */
+        ButtonDebounce(const unsigned long cTimeout, const unsigned long zTimeout,
+            const uint8_t cId = 0, const uint8_t zId = 1)
+            : m_buttonC{cTimeout, cId},
+            m_buttonZ{zTimeout, zId}
+        {}
+
+        /**
+         * @brief   Übernimmt die Gedrücktzustände eines neuen Datensatzes
+         */
+        void update(const bool pressedC, const bool pressedZ)
+        {
+            m_buttonC.update(pressedC);
+            m_buttonZ.update(pressedZ);
+        }
+
+        /**
+         * @brief   Setzt beide Buttons ohne Entprellung auf losgelassen
+         */
+        void release()
+        {
+            m_buttonC.release();
+            m_buttonZ.release();
+        }
+
+        Button &buttonC() { return m_buttonC; }
+        const Button &buttonC() const { return m_buttonC; }
+
+        Button &buttonZ() { return m_buttonZ; }
+        const Button &buttonZ() const { return m_buttonZ; }
+
+    private:
+        FrameButton m_buttonC; // Repräsentation des C-Buttons
+        FrameButton m_buttonZ; // Repräsentation des Z-Buttons
+    };
+
+    /********************
+     * Filter-Policies *
+     ********************/
+
+    /**
+     * @brief   Keine Filterung der Beschleunigungswerte.
+     */
+    class NoFilter
+    {
+    public:
+        static constexpr const bool ENABLED{false};
+
+        // unveränderte Datensätze werden nicht benötigt
+        static constexpr const bool DUPLICATES{false};
+
+        /**
+         * @return  true neuer Ausgabewert liegt vor (immer)
+         */
+        const bool update(const int16_t, const int16_t, const int16_t) { return true; }
+    };
+
+    /**
+     * @brief   Gleitender Mittelwert über die letzten Width Beschleunigungswerte je Achse.
+     *
+     * @tparam  Width Anzahl der gemittelten Werte
+     */
+    template<size_t Width>
+    class MovingAverageFilter
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        static constexpr const bool DUPLICATES{false};
+
+        /**
+         * @return  true neuer Ausgabewert liegt vor (immer)
+         */
+        const bool update(const int16_t x, const int16_t y, const int16_t z)
+        {
+            m_x.shift(x);
+            m_y.shift(y);
+            m_z.shift(z);
+            return true;
+        }
+
+        const int16_t accelerationX() const { return m_x.cumulativeSum() / static_cast<int32_t>(Width); }
+        const int16_t accelerationY() const { return m_y.cumulativeSum() / static_cast<int32_t>(Width); }
+        const int16_t accelerationZ() const { return m_z.cumulativeSum() / static_cast<int32_t>(Width); }
+
+    private:
+        MovingAverage<int16_t, Width> m_x; // Beschleunigung in X-Richtung
+        MovingAverage<int16_t, Width> m_y; // Beschleunigung in Y-Richtung
+        MovingAverage<int16_t, Width> m_z; // Beschleunigung in Z-Richtung
+    };
+
+    /**
+     * @brief   Gleitender Median über die letzten Width Beschleunigungswerte je Achse. Einzelne
+     *          Ausreißer (z. B. Bitfehler auf langen Leitungen) werden verworfen statt über das
+     *          Fenster verteilt, der Ausgabewert folgt dem Signal aber um (Width - 1) / 2
+     *          Datensätze verzögert.
+     *
+     * @tparam  Width Anzahl der Werte im Fenster, ungerade
+     */
+    template<size_t Width>
+    class MedianFilter
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        static constexpr const bool DUPLICATES{false};
+
+        /**
+         * @return  true neuer Ausgabewert liegt vor (immer)
+         */
+        const bool update(const int16_t x, const int16_t y, const int16_t z)
+        {
+            const int16_t values[3]{x, y, z};
+            m_window.shift(values);
+            return true;
+        }
+
+        const int16_t accelerationX() const { return m_window.median(0); }
+        const int16_t accelerationY() const { return m_window.median(1); }
+        const int16_t accelerationZ() const { return m_window.median(2); }
+
+    private:
+        MovingMedian<int16_t, Width, 3> m_window; // Fenster der drei Achsen
+    };
+
+    /**
+     * @brief   Hampel-Filter: der neueste Beschleunigungswert wird unverändert und ohne
+     *          Verzögerung ausgegeben, solange er um höchstens Threshold Standardabweichungen
+     *          vom Median des Fensters abweicht, sonst wird er durch den Median ersetzt. Die
+     *          Standardabweichung wird robust als 1,4826 * MAD geschätzt (in Festkomma 95 / 64),
+     *          mindestens jedoch 1 LSB, damit Quantisierungsrauschen nicht als Ausreißer gilt.
+     *
+     * @tparam  Width Anzahl der Werte im Fenster, ungerade
+     * @tparam  Threshold Schwelle in Standardabweichungen
+     */
+    template<size_t Width, uint8_t Threshold = 3>
+    class HampelFilter
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        static constexpr const bool DUPLICATES{false};
+
+        HampelFilter()
+            : m_window{},
+            m_output{},
+            m_rejected{0}
+        {}
+
+        /**
+         * @return  true neuer Ausgabewert liegt vor (immer)
+         */
+        const bool update(const int16_t x, const int16_t y, const int16_t z)
+        {
+            const int16_t values[3]{x, y, z};
+            m_window.shift(values);
+
+            for (uint8_t axis = 0; axis < 3; axis++)
+            {
+                const int16_t median = m_window.median(axis);
+                const int16_t mad = m_window.deviation(axis);
+                const int32_t limit = (static_cast<int32_t>(Threshold) * ((mad > 0) ? mad : 1) * 95) >> 6;
+                const int32_t distance = static_cast<int32_t>(values[axis]) - median;
+
+                if (distance > limit || distance < -limit)
+                {
+                    m_output[axis] = median;
+                    m_rejected++;
+                }
+                else
+                {
+                    m_output[axis] = values[axis];
+                }
+            }
+            return true;
+        }
+
+        const int16_t accelerationX() const { return m_output[0]; }
+        const int16_t accelerationY() const { return m_output[1]; }
+        const int16_t accelerationZ() const { return m_output[2]; }
+
+        /**
+         * @brief   Gibt die Anzahl der ersetzten Werte aller Achsen zurück
+         */
+        const uint32_t rejected() const { return m_rejected; }
+
+    private:
+        MovingMedian<int16_t, Width, 3> m_window; // Fenster der drei Achsen
+        int16_t m_output[3]; // letzte Ausgabewerte
+        uint32_t m_rejected; // Anzahl ersetzter Werte
+    };
+
+    /**
+     * @brief   Überabtastung mit Dezimierung (CIC-Filter erster Ordnung bzw. Boxcar): je Achse
+     *          werden Samples Datensätze aufsummiert und als ein Ausgabewert mit höherer
+     *          Auflösung ausgegeben.
+     *
+     *          Bei mindestens etwa 1 LSB Rauschen (wirkt als Dither) sinkt das Rauschen um den
+     *          Faktor sqrt(Samples), die Auflösung steigt um RESOLUTION_BITS = log2(Samples) / 2
+     *          Bit, z. B. 12 Bit bei 16 Datensätzen. Die Ausgabewerte sind entsprechend mit
+     *          2^RESOLUTION_BITS skaliert.
+     *
+     *          Die Zykluszeit wird dazu um den Faktor Samples verkürzt, z. B. 2 ms bei 16
+     *          Datensätzen für eine Ausgaberate von ca. 31 Hz. Eine Transaktion (6 Byte lesen,
+     *          Registerzeiger setzen) belegt bei 400 kHz etwa 0,3 ms, die Buslast beträgt dann
+     *          ca. 15 % statt 1 % bei 30 ms Zykluszeit.
+     *
+     * @tparam  Samples Anzahl der Datensätze je Ausgabewert, Zweierpotenz
+     */
+    template<size_t Samples>
+    class DecimationFilter
+    {
+    public:
+        static_assert(Samples > 0 && (Samples & (Samples - 1)) == 0, "Samples muss eine Zweierpotenz sein");
+
+        static constexpr const bool ENABLED{true};
+
+        // auch unveränderte Datensätze zählen, damit die Ausgaberate konstant bleibt
+        static constexpr const bool DUPLICATES{true};
+
+        // log2(Samples)
+        static constexpr const uint8_t SAMPLES_BITS{
+            static_cast<uint8_t>((Samples >= 2) + (Samples >= 4) + (Samples >= 8) + (Samples >= 16)
+                + (Samples >= 32) + (Samples >= 64) + (Samples >= 128) + (Samples >= 256))};
+        static_assert(Samples <= 256, "höchstens 256 Datensätze je Ausgabewert");
+
+        // zusätzliche Auflösung der Ausgabewerte in Bit
+        static constexpr const uint8_t RESOLUTION_BITS{SAMPLES_BITS / 2};
+
+    private:
+        // beim Kürzen der Summe verworfene Bits und Rundungswert
+        static constexpr const uint8_t SHIFT{SAMPLES_BITS - RESOLUTION_BITS};
+        static constexpr const int32_t ROUNDING{(SHIFT > 0) ? (1L << SHIFT) / 2 : 0};
+
+    public:
+
+        DecimationFilter()
+            : m_sumX{0},
+            m_sumY{0},
+            m_sumZ{0},
+            m_count{0},
+            m_x{0},
+            m_y{0},
+            m_z{0},
+            m_outputs{0}
+        {}
+
+        /**
+         * @return  true neuer Ausgabewert liegt vor
+         * @return  false noch nicht genügend Datensätze
+         */
+        const bool update(const int16_t x, const int16_t y, const int16_t z)
+        {
+            m_sumX += x;
+            m_sumY += y;
+            m_sumZ += z;
+
+            if (++m_count < Samples)
+            {
+                return false;
+            }
+
+            // Summe um die nicht durch Rauschminderung gedeckten Bits kürzen, gerundet statt
+            // abgeschnitten, sonst läge jeder Ausgabewert im Mittel knapp 1/2 LSB zu tief
+            m_x = static_cast<int16_t>((m_sumX + ROUNDING) >> SHIFT);
+            m_y = static_cast<int16_t>((m_sumY + ROUNDING) >> SHIFT);
+            m_z = static_cast<int16_t>((m_sumZ + ROUNDING) >> SHIFT);
+
+            m_sumX = 0;
+            m_sumY = 0;
+            m_sumZ = 0;
+            m_count = 0;
+            m_outputs++;
+            return true;
+        }
+
+        const int16_t accelerationX() const { return m_x; }
+        const int16_t accelerationY() const { return m_y; }
+        const int16_t accelerationZ() const { return m_z; }
+
+        /**
+         * @brief   Gibt die Anzahl der bisher ausgegebenen Werte zurück. Eine Änderung zeigt
+         *          einen neuen Ausgabewert an.
+         */
+        const uint32_t outputs() const { return m_outputs; }
+
+    private:
+        int32_t m_sumX; // Summe in X-Richtung
+        int32_t m_sumY; // Summe in Y-Richtung
+        int32_t m_sumZ; // Summe in Z-Richtung
+        size_t m_count; // Anzahl der Datensätze in der aktuellen Summe
+        int16_t m_x; // letzter Ausgabewert in X-Richtung
+        int16_t m_y; // letzter Ausgabewert in Y-Richtung
+        int16_t m_z; // letzter Ausgabewert in Z-Richtung
+        uint32_t m_outputs; // Anzahl der Ausgabewerte
+    };
+
+    /***********************
+     * Zyklus-Policies *
+     ***********************/
+
+    /**
+     * @brief   Keine eigene Zykluszeit, jeder Aufruf von read() führt eine Bustransaktion durch.
+     *          Die Anwendung bestimmt den Takt selbst.
+     */
+    class NoCycleTimer
+    {
+    public:
+        static constexpr const bool ENABLED{false};
+
+        NoCycleTimer(const unsigned long) {}
+
+        const bool due() { return true; }
+    };
+
+    /**
+     * @brief   Feste Zykluszeit, optional mit Verteilung der Transaktionen durch einen
+     *          BusScheduler.
+     */
+    class CycleTimer
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        /**
+         * @param cycletime Zykluszeit nach der wieder Daten angefordert werden in ms
+         */
+        CycleTimer(const unsigned long cycletime)
+            : m_cycletime{cycletime},
+            m_deadline{},
+            m_scheduler{nullptr},
+            m_schedulerId{BusScheduler::INVALID_CLIENT}
+        {}
+
+        ~CycleTimer()
+        {
+            detach();
+        }
+
+        /**
+         * @brief   Prüft, ob die Zykluszeit abgelaufen ist bzw. der Scheduler den Bus freigibt
+         *
+         * @return  true Transaktion ist fällig
+         */
+        const bool due()
+        {
+            if (m_scheduler)
+            {
+                if (!m_scheduler->request(m_schedulerId))
+                {
+                    return false;
+                }
+            }
+            else if (m_deadline.pending())
+            {
+                return false;
+            }
+
+            // beim Scheduler nur als Schätzung des nächsten Zyklus
+            m_deadline.start(m_cycletime * 1000UL);
+            return true;
+        }
+
+        /**
+         * @brief   Gibt den Zeitgeber des nächsten Zyklus zurück
+         */
+        const Deadline &deadline() const
+        {
+            return m_deadline;
+        }
+
+        /**
+         * @brief   Meldet sich mit der Zykluszeit als Periode beim Scheduler an
+         */
+        const bool attach(BusScheduler &scheduler)
+        {
+            detach();
+
+            m_schedulerId = scheduler.attach(m_cycletime);
+            if (m_schedulerId == BusScheduler::INVALID_CLIENT)
+            {
+                return false;
+            }
+
+            m_scheduler = &scheduler;
+            return true;
+        }
+
+        /**
+         * @brief   Meldet sich vom Scheduler ab
+         */
+        void detach()
+        {
+            if (!m_scheduler)
+                return;
+
+            m_scheduler->detach(m_schedulerId);
+            m_scheduler = nullptr;
+            m_schedulerId = BusScheduler::INVALID_CLIENT;
+        }
+
+    private:
+        // Zeitspanne nach der erneut Daten vom Nunchuk angefordert werden
+        const unsigned long m_cycletime;
+
+        // Ablauf der Zykluszeit seit der letzten Anforderung
+        Deadline m_deadline;
+
+        // Scheduler des Busses, nullptr falls nicht angemeldet
+        BusScheduler *m_scheduler;
+
+        // Kennung beim Scheduler
+        uint8_t m_schedulerId;
+    };
+
+    /***************************
+     * Erweiterungs-Policies *
+     ***************************/
+
+    // Erweiterungen und ihre Policies, definiert im Header der jeweiligen Erweiterung; nur wer
+    // eine Policy verwendet, bindet ihren Header ein
+    class AutoCenter;
+    class AutoCenterSupport;
+    class Failsafe;
+    class FailsafeSupport;
+    class GestureRecognizer;
+    class GestureSupport;
+    class I2CMultiplexer;
+    class MultiplexerSupport;
+    class ProfileStorage;
+    class ProfileSupport;
+    class Publisher;
+    class PublisherSupport;
+
+    /**
+     * @brief   Misst die Zeit vom Aufruf von begin() bis zum ersten veröffentlichten Datensatz,
+     *          siehe NunchukT::timeToFirstSample().
+     */
+    class StartupTiming
+    {
+    public:
+        static constexpr const bool ENABLED{true};
+
+        StartupTiming()
+            : m_beginTime{0},
+            m_elapsed{0},
+            m_awaiting{false}
+        {}
+
+        /**
+         * @brief   Startet die Messung, z. B. in begin()
+         */
+        void start(const unsigned long now)
+        {
+            m_beginTime = now;
+            m_elapsed = 0;
+            m_awaiting = true;
+        }
+
+        /**
+         * @brief   Beendet die Messung beim ersten veröffentlichten Datensatz
+         */
+        void sample(const unsigned long now)
+        {
+            if (m_awaiting)
+            {
+                m_elapsed = now - m_beginTime;
+                m_awaiting = false;
+            }
+        }
+
+        /**
+         * @return  unsigned long Zeitspanne in µs, 0 solange noch kein Datensatz vorliegt
+         */
+        const unsigned long elapsed() const { return m_elapsed; }
+
+    private:
+        unsigned long m_beginTime; // Zeitpunkt des letzten Aufrufs von begin() in µs
+        unsigned long m_elapsed; // Zeit von begin() bis zum ersten Datensatz in µs
+        bool m_awaiting; // erster Datensatz nach begin() steht noch aus
+    };
+
+    /**
+     * @brief   Vergleicht zwei Erweiterungs-Policies
+     */
+    template<class Feature, class Other>
+    struct IsSameFeature
+    {
+        static constexpr const bool VALUE{false};
+    };
+
+    template<class Feature>
+    struct IsSameFeature<Feature, Feature>
+    {
+        static constexpr const bool VALUE{true};
+    };
+
+    /**
+     * @brief   Gibt zurück, ob Feature in der Liste Features enthalten ist
+     */
+    template<class Feature, class... Features>
+    constexpr const bool containsFeature()
+    {
+        return (IsSameFeature<Feature, Features>::VALUE || ...);
+    }
+
+    /**
+     * @brief   Zustand der Erweiterungs-Policies eines NunchukT. Ohne Policies leer, jede
+     *          Policy bringt nur ihren eigenen Zustand mit.
+     *
+     * @tparam  Features Erweiterungs-Policies, z. B. FailsafeSupport, PublisherSupport
+     */
+    template<class... Features>
+    class FeatureSet : public Features...
+    {
+    public:
+        /**
+         * @brief   Feature selbst, aber abhängig von Features: Zugriffe über diesen Typ prüft
+         *          der Compiler erst bei der Instanziierung, der Header der Erweiterung wird
+         *          also nur benötigt, wenn ihre Policy verwendet wird
+         */
+        template<class Feature>
+        using Type = Feature;
+    };
+}
+
+#endif // !NUNCHUK_POLICIES_H
@@ -0,0 +1,216 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "PowerSaver.h"
+
+#include <Arduino.h>
+
+#if defined(__AVR__)
+#include <avr/interrupt.h>
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+
+#if NUNCHUK_POWERSAVER_WDT_ISR
+ISR(WDT_vect)
+{
+	// nur Aufwachen aus dem Power-Down, die vorherige Einstellung wird danach wiederhergestellt
+}
+#endif
+#elif defined(ESP32)
+#include <esp_sleep.h>
+#endif
+
+namespace communication
+{
+	namespace
+	{
+		// kürzeste Periode des Watchdogs (2048 Takte bei 128 kHz) in µs
+		constexpr const unsigned long WATCHDOG_BASE_US{16000};
+
+		// größter Teiler des Watchdogs, Periode WATCHDOG_BASE_US << WATCHDOG_MAX_PRESCALER (8 s)
+		constexpr const uint8_t WATCHDOG_MAX_PRESCALER{9};
+
+		// Periode von Timer 0 bzw. des Aufwachens im Idle-Modus in µs (AVR, 16 MHz)
+		constexpr const unsigned long IDLE_WAKEUP_US{1100};
+	}
+
+	PowerSaver::PowerSaver(const SleepMode mode, const unsigned long limit)
+		: m_mode{mode},
+		m_limit{limit},
+		m_start{Clock::now()},
+		m_asleep{0}
+	{
+	}
+
+	const unsigned long PowerSaver::sleep(const unsigned long us)
+	{
+		const unsigned long target = Clock::current() + ((us < m_limit) ? us : m_limit);
+
+		Clock::tick();
+		if (Clock::reached(target))
+		{
+			return 0;
+		}
+
+		const unsigned long start = Clock::now();
+		const unsigned long remaining = target - start;
+
+		if (m_mode == SleepMode::NONE || remaining < MIN_SLEEP_US)
+		{
+			wait(target);
+		}
+		else
+		{
+			if (m_mode == SleepMode::POWER_DOWN && remaining >= POWER_DOWN_MIN_US)
+			{
+				powerDown(target);
+			}
+			idle(target);
+		}
+
+		return Clock::now() - start;
+	}
+
+	void PowerSaver::setMode(const SleepMode mode)
+	{
+		m_mode = mode;
+	}
+
+	const uint16_t PowerSaver::dutyCycle() const
+	{
+		const unsigned long elapsed = Clock::now() - m_start;
+
+		if (elapsed < 1000)
+		{
+			return 1000;
+		}
+
+		return static_cast<uint16_t>((elapsed - m_asleep) / (elapsed / 1000));
+	}
+
+	const unsigned long PowerSaver::asleep() const
+	{
+		return m_asleep;
+	}
+
+	void PowerSaver::resetStatistics()
+	{
+		m_start = Clock::now();
+		m_asleep = 0;
+	}
+
+	void PowerSaver::idle(const unsigned long target)
+	{
+#if defined(__AVR__)
+		// Timer 0 weckt etwa jede Millisekunde, den Rest danach aktiv warten
+		set_sleep_mode(SLEEP_MODE_IDLE);
+		Clock::tick();
+		while (!Clock::reached(target) && (target - Clock::now()) > IDLE_WAKEUP_US)
+		{
+			const unsigned long before = Clock::now();
+			sleep_mode();
+			Clock::tick();
+			m_asleep += Clock::now() - before;
+		}
+		wait(target);
+#else
+		// delay() gibt die CPU frei (FreeRTOS) bzw. schreitet in der virtuellen Zeit des
+		// Host-Builds voran und zählt daher als Schlaf
+		const unsigned long before = Clock::now();
+		wait(target);
+		m_asleep += Clock::now() - before;
+#endif
+	}
+
+	void PowerSaver::powerDown(const unsigned long target)
+	{
+#if defined(__AVR__)
+		for (;;)
+		{
+			Clock::tick();
+			if (Clock::reached(target))
+			{
+				return;
+			}
+
+			// längste Periode, die auch bei 10 % Abweichung des Watchdogs vor dem Zeitpunkt endet
+			const unsigned long remaining = target - Clock::now();
+			uint8_t prescaler = WATCHDOG_MAX_PRESCALER + 1;
+			unsigned long period = 0;
+			while (prescaler > 0)
+			{
+				prescaler--;
+				period = WATCHDOG_BASE_US << prescaler;
+				if (period + period / 10 <= remaining)
+				{
+					break;
+				}
+				period = 0;
+			}
+
+			if (period == 0)
+			{
+				return;
+			}
+
+			noInterrupts();
+			const uint8_t previous = WDTCSR;
+			wdt_reset();
+			MCUSR &= ~_BV(WDRF);
+			WDTCSR = _BV(WDCE) | _BV(WDE);
+			WDTCSR = _BV(WDIE) | (prescaler & 0x07) | ((prescaler & 0x08) ? _BV(WDP3) : 0);
+			set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+			sleep_enable();
+			interrupts();
+			sleep_cpu();
+			sleep_disable();
+
+			// vorherige Einstellung des Watchdogs wiederherstellen (zeitgesteuerte Sequenz),
+			// ein gesetztes WDIF wird dabei gelöscht
+			noInterrupts();
+			wdt_reset();
+			WDTCSR = _BV(WDCE) | _BV(WDE);
+			WDTCSR = previous;
+			interrupts();
+
+			// Timer 0 stand still, die Periode der Uhr gutschreiben
+			Clock::advance(period);
+			m_asleep += period;
+		}
+#elif defined(ESP32)
+		// die Systemzeit läuft im Light-Sleep weiter
+		Clock::tick();
+		if (!Clock::reached(target))
+		{
+			const unsigned long before = Clock::now();
+			esp_sleep_enable_timer_wakeup(target - before);
+			esp_light_sleep_start();
+			Clock::tick();
+			m_asleep += Clock::now() - before;
+		}
+#else
+		(void)target;
+#endif
+	}
+
+	void PowerSaver::wait(const unsigned long target)
+	{
+		Clock::tick();
+		while (!Clock::reached(target))
+		{
+			const unsigned long remaining = target - Clock::now();
+
+			if (remaining >= 1000)
+			{
+				delay(remaining / 1000);
+			}
+			else
+			{
+				delayMicroseconds(static_cast<unsigned int>(remaining));
+			}
+			Clock::tick();
+		}
+	}
+} // namespace communication
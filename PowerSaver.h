@@ -0,0 +1,165 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   PowerSaver.h
+ *
+ * @brief  Klassendefinition eines Helfers, der den Mikrocontroller bis zum nächsten
+ *         Ereignis des Treibers schlafen legt
+ */
+
+#ifndef POWER_SAVER_H
+#define POWER_SAVER_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+
+// 1: die Bibliothek definiert auf AVR einen leeren Watchdog-Interrupt (ISR(WDT_vect)) zum
+// Aufwachen aus dem Power-Down, 0: die Anwendung stellt ihn selbst bereit
+#ifndef NUNCHUK_POWERSAVER_WDT_ISR
+#define NUNCHUK_POWERSAVER_WDT_ISR 0
+#endif
+
+namespace communication
+{
+
+/**
+ * @brief Schlafmodus zwischen den Abfragen
+ */
+enum class SleepMode : uint8_t
+{
+	// aktives Warten (delay), z. B. zum Vergleich
+	NONE = 0,
+
+	// CPU angehalten, Timer und Peripherie laufen weiter (AVR: Aufwachen mit jedem Überlauf
+	// von Timer 0, d. h. etwa jede Millisekunde)
+	IDLE,
+
+	// AVR: Power-Down mit Aufwachen durch den Watchdog in Schritten von 16 ms bis 8 s, der Rest
+	// im Idle-Modus; ESP32: Light-Sleep mit Aufwachen durch den RTC-Timer
+	POWER_DOWN
+};
+
+/**
+ * @brief Legt den Mikrocontroller bis zum nächsten Ereignis des Treibers schlafen, z. B.
+ * bis zur nächsten Abfrage, dem Ablauf der Entprellung oder dem nächsten Verbindungsaufbau
+ * (siehe NunchukT::timeUntilNextEvent()). Es wird nie länger als bis zum Ereignis geschlafen.
+ *
+ * Im Power-Down steht Timer 0 und damit micros() still. Die geschlafene Zeitspanne wird Clock
+ * mit Clock::advance() gutgeschrieben, alle Zeitgeber der Bibliothek bleiben damit korrekt;
+ * millis()/micros() der Anwendung gehen danach nach. Der Watchdog ist auf ±10 % genau,
+ * Power-Down wird daher nur für Zeitspannen ab POWER_DOWN_MIN_US verwendet und um diese
+ * Toleranz verkürzt. Andere Interrupts, die aus dem Power-Down wecken (z. B. externe Pins),
+ * verkürzen den Schlaf, ohne dass die Uhr das bemerkt.
+ *
+ * Auf AVR weckt der Watchdog-Interrupt. ISR(WDT_vect) definiert die Bibliothek nur mit
+ * NUNCHUK_POWERSAVER_WDT_ISR=1, sonst muss die Anwendung ihn bereitstellen (ein leerer genügt),
+ * da ein fehlender Interrupt-Vektor den Mikrocontroller zurücksetzt. Die Einstellung des
+ * Watchdogs (WDTCSR) wird nach jedem Aufwachen wiederhergestellt, ein von der Anwendung
+ * genutzter Watchdog läuft danach weiter.
+ */
+class PowerSaver
+{
+
+public: // public static Member
+	// kürzere Zeitspannen werden aktiv gewartet, das Einschlafen lohnt nicht
+	static constexpr const unsigned long MIN_SLEEP_US{200};
+
+	// kürzeste Zeitspanne, für die Power-Down verwendet wird (kürzeste Watchdog-Periode
+	// zuzüglich Toleranz)
+	static constexpr const unsigned long POWER_DOWN_MIN_US{20000};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse PowerSaver.
+	 *
+	 * @param mode Schlafmodus
+	 * @param limit längste Zeitspanne eines Aufrufs in µs, z. B. um Clock::NEVER zu begrenzen
+	 */
+	PowerSaver(const SleepMode mode = SleepMode::IDLE, const unsigned long limit = 1000000);
+
+	/**
+	 * @brief Schläft die übergebene Zeitspanne ab dem aktuellen Zeitpunkt (Clock::current(),
+	 * wie NunchukT::timeUntilNextEvent()). Tastet die Uhr danach ab.
+	 *
+	 * @param us Zeitspanne in µs, z. B. von NunchukT::timeUntilNextEvent()
+	 * @return unsigned long tatsächlich geschlafene bzw. gewartete Zeitspanne in µs
+	 */
+	const unsigned long sleep(const unsigned long us);
+
+	/**
+	 * @brief Schläft bis zum nächsten Ereignis des Geräts
+	 *
+	 * @tparam Device Konfiguration von NunchukT
+	 * @param device Gerät
+	 * @return unsigned long tatsächlich geschlafene Zeitspanne in µs
+	 */
+	template<class Device>
+	const unsigned long sleepUntilNextEvent(const Device &device)
+	{
+		return sleep(device.timeUntilNextEvent());
+	}
+
+	/**
+	 * @brief Setzt den Schlafmodus
+	 */
+	void setMode(const SleepMode mode);
+
+	/**
+	 * @brief Gibt den Anteil der Zeit zurück, in der der Mikrocontroller seit dem letzten
+	 * Aufruf von resetStatistics() wach war. Die Messung umfasst höchstens etwa 70 Minuten
+	 * (Überlauf von unsigned long in µs).
+	 *
+	 * @return uint16_t Wachanteil in Promille
+	 */
+	const uint16_t dutyCycle() const;
+
+	/**
+	 * @brief Gibt die seit dem letzten Aufruf von resetStatistics() geschlafene Zeit zurück
+	 *
+	 * @return unsigned long Zeitspanne in µs
+	 */
+	const unsigned long asleep() const;
+
+	/**
+	 * @brief Startet die Messung des Wachanteils neu
+	 */
+	void resetStatistics();
+
+private: // private Methoden
+	/**
+	 * @brief Schläft im Idle-Modus bis kurz vor dem Zeitpunkt und wartet den Rest aktiv
+	 *
+	 * @param target Zeitpunkt auf Basis von Clock in µs
+	 */
+	void idle(const unsigned long target);
+
+	/**
+	 * @brief Schläft im Power-Down, solange mindestens eine Watchdog-Periode vor dem
+	 * Zeitpunkt liegt
+	 *
+	 * @param target Zeitpunkt auf Basis von Clock in µs
+	 */
+	void powerDown(const unsigned long target);
+
+	/**
+	 * @brief Wartet aktiv bis zum Zeitpunkt
+	 *
+	 * @param target Zeitpunkt auf Basis von Clock in µs
+	 */
+	static void wait(const unsigned long target);
+
+private: // private Member
+	SleepMode m_mode; // Schlafmodus
+	const unsigned long m_limit; // längste Zeitspanne eines Aufrufs in µs
+	unsigned long m_start; // Beginn der Messung des Wachanteils in µs
+	unsigned long m_asleep; // geschlafene Zeit seit Beginn der Messung in µs
+
+};
+
+} // namespace communication
+
+#endif // !POWER_SAVER_H
@@ -0,0 +1,195 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Predictor.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	AlphaBetaPredictor::AlphaBetaPredictor(const int16_t minimum, const int16_t maximum,
+		const uint16_t alpha, const uint16_t beta)
+		: m_minimum{minimum},
+		m_maximum{maximum},
+		m_alpha{alpha},
+		m_beta{beta},
+		m_horizon{40000},
+		m_position{0},
+		m_velocity{0},
+		m_time{0},
+		m_initialized{false}
+	{
+	}
+
+	void AlphaBetaPredictor::setHorizon(const unsigned long horizon)
+	{
+		m_horizon = (horizon < MAX_GAP) ? horizon : MAX_GAP;
+	}
+
+	void AlphaBetaPredictor::setRange(const int16_t minimum, const int16_t maximum)
+	{
+		m_minimum = minimum;
+		m_maximum = maximum;
+	}
+
+	void AlphaBetaPredictor::update(const int16_t value, const unsigned long time)
+	{
+		const int32_t measured = static_cast<int32_t>(value) << 8;
+		const uint32_t elapsed = time - m_time;
+
+		// erster Datensatz oder zu große Lücke, Änderungsrate nicht schätzbar
+		if (!m_initialized || elapsed > MAX_GAP)
+		{
+			m_position = measured;
+			m_velocity = 0;
+			m_time = time;
+			m_initialized = true;
+			return;
+		}
+
+		if (elapsed == 0)
+		{
+			m_position = measured;
+			return;
+		}
+
+		// Vorhersage für den Messzeitpunkt und Korrektur um die gewichtete Abweichung, die
+		// Begrenzung hält die Abweichung auch nach langen Lücken im 32-Bit-Bereich
+		const int32_t predicted = limit(m_position + extrapolate(m_velocity, elapsed));
+		const int32_t residual = measured - predicted;
+
+		m_position = predicted + ((residual * m_alpha) >> 8);
+		m_velocity += (((residual * m_beta) >> 8) << 10) / static_cast<int32_t>(elapsed);
+
+		// begrenzt die Änderungsrate, damit die Extrapolation nicht überläuft
+		constexpr const int32_t limit = static_cast<int32_t>(1) << 14;
+		if (m_velocity > limit)
+		{
+			m_velocity = limit;
+		}
+		else if (m_velocity < -limit)
+		{
+			m_velocity = -limit;
+		}
+
+		m_time = time;
+	}
+
+	const int16_t AlphaBetaPredictor::predict(const unsigned long time) const
+	{
+		if (!m_initialized)
+		{
+			return 0;
+		}
+
+		uint32_t elapsed = time - m_time;
+		if (static_cast<int32_t>(time - m_time) < 0)
+		{
+			// Abfragezeitpunkt vor dem letzten Datensatz, z. B. vor dem Abfragen ermittelt
+			elapsed = 0;
+		}
+		else if (elapsed > m_horizon)
+		{
+			elapsed = m_horizon;
+		}
+
+		const int32_t estimate = (m_position + extrapolate(m_velocity, elapsed) + 0x80) >> 8;
+
+		if (estimate < m_minimum)
+		{
+			return m_minimum;
+		}
+		if (estimate > m_maximum)
+		{
+			return m_maximum;
+		}
+		return static_cast<int16_t>(estimate);
+	}
+
+	void AlphaBetaPredictor::reset()
+	{
+		m_position = 0;
+		m_velocity = 0;
+		m_initialized = false;
+	}
+
+	const int32_t AlphaBetaPredictor::extrapolate(const int32_t velocity, const uint32_t elapsed)
+	{
+		// |velocity| <= 2^14, bis 65 ms genügt das 32-Bit-Produkt
+		if (elapsed <= 0xFFFF)
+		{
+			return (velocity * static_cast<int32_t>(elapsed)) >> 10;
+		}
+		return static_cast<int32_t>((static_cast<int64_t>(velocity) * elapsed) >> 10);
+	}
+
+	const int32_t AlphaBetaPredictor::limit(const int32_t value) const
+	{
+		const int32_t minimum = static_cast<int32_t>(m_minimum) << 8;
+		const int32_t maximum = static_cast<int32_t>(m_maximum) << 8;
+
+		if (value < minimum)
+		{
+			return minimum;
+		}
+		if (value > maximum)
+		{
+			return maximum;
+		}
+		return value;
+	}
+
+	MotionPredictor::MotionPredictor(const uint16_t alpha, const uint16_t beta)
+		: m_joystickX{-Joystick::X_NULL, 0xFF - Joystick::X_NULL, alpha, beta},
+		m_joystickY{-Joystick::Y_NULL, 0xFF - Joystick::Y_NULL, alpha, beta},
+		m_accelerationX{-Acceleration::X_NULL, 0x3FF - Acceleration::X_NULL, alpha, beta},
+		m_accelerationY{-Acceleration::Y_NULL, 0x3FF - Acceleration::Y_NULL, alpha, beta},
+		m_accelerationZ{-Acceleration::Z_NULL, 0x3FF - Acceleration::Z_NULL, alpha, beta}
+	{
+	}
+
+	void MotionPredictor::setHorizon(const unsigned long horizon)
+	{
+		m_joystickX.setHorizon(horizon);
+		m_joystickY.setHorizon(horizon);
+		m_accelerationX.setHorizon(horizon);
+		m_accelerationY.setHorizon(horizon);
+		m_accelerationZ.setHorizon(horizon);
+	}
+
+	const int16_t MotionPredictor::joystickX(const unsigned long time) const
+	{
+		return m_joystickX.predict(time);
+	}
+
+	const int16_t MotionPredictor::joystickY(const unsigned long time) const
+	{
+		return m_joystickY.predict(time);
+	}
+
+	const int16_t MotionPredictor::accelerationX(const unsigned long time) const
+	{
+		return m_accelerationX.predict(time);
+	}
+
+	const int16_t MotionPredictor::accelerationY(const unsigned long time) const
+	{
+		return m_accelerationY.predict(time);
+	}
+
+	const int16_t MotionPredictor::accelerationZ(const unsigned long time) const
+	{
+		return m_accelerationZ.predict(time);
+	}
+
+	void MotionPredictor::reset()
+	{
+		m_joystickX.reset();
+		m_joystickY.reset();
+		m_accelerationX.reset();
+		m_accelerationY.reset();
+		m_accelerationZ.reset();
+	}
+} // namespace communication
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Predictor.h
+ *
+ * @brief  Klassendefinition eines Alpha-Beta-Filters, das Sensorwerte zwischen zwei
+ *         Abfragen des Nunchuks extrapoliert (Festkomma)
+ */
+
+#ifndef PREDICTOR_H
+#define PREDICTOR_H
+
+#include <Arduino.h>
+
+#include "Nunchuk.h"
+
+namespace communication
+{
+
+/**
+ * @brief Alpha-Beta-Filter für einen Kanal. Schätzt aus den zeitgestempelten Datensätzen
+ * 		  Wert und Änderungsrate und extrapoliert damit auf beliebige Zeitpunkte zwischen zwei
+ * 		  Abfragen. Die Schätzung wird höchstens um den Vorhersagehorizont fortgeschrieben und
+ * 		  auf den gültigen Wertebereich begrenzt.
+ *
+ * 		  Wert in Festkomma Q8, Änderungsrate in Q8 je 1024 µs. update() benötigt eine
+ * 		  32-Bit-Division, predict() bei einem Horizont bis 65 ms eine 32-Bit-Multiplikation
+ * 		  und ist damit auch für Regelschleifen im Kilohertzbereich geeignet.
+ */
+class AlphaBetaPredictor
+{
+
+public: // public static Member
+	// Verstärkung 1,0 (Festkomma Q8)
+	static constexpr const uint16_t UNITY_GAIN{256};
+
+	// größter zulässiger Abstand zweier Datensätze in µs, darüber wird neu gestartet
+	static constexpr const uint32_t MAX_GAP{1000000};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse AlphaBetaPredictor.
+	 * 		  alpha = beta = UNITY_GAIN entspricht linearer Extrapolation der letzten zwei
+	 * 		  Datensätze, kleinere Werte glätten stärker, reagieren aber träger.
+	 *
+	 * @param minimum kleinster gültiger Wert
+	 * @param maximum größter gültiger Wert
+	 * @param alpha Gewichtung der Abweichung für den Wert (Q8)
+	 * @param beta Gewichtung der Abweichung für die Änderungsrate (Q8)
+	 */
+	AlphaBetaPredictor(const int16_t minimum, const int16_t maximum,
+		const uint16_t alpha = 224, const uint16_t beta = 128);
+
+	/**
+	 * @brief Setzt den Vorhersagehorizont, über den hinaus nicht weiter extrapoliert wird.
+	 * 		  Sollte etwas über der Zykluszeit liegen.
+	 *
+	 * @param horizon Vorhersagehorizont in µs, höchstens MAX_GAP
+	 */
+	void setHorizon(const unsigned long horizon);
+
+	/**
+	 * @brief Setzt den gültigen Wertebereich, z. B. nach einer Änderung des Mittenwerts
+	 *
+	 * @param minimum kleinster gültiger Wert
+	 * @param maximum größter gültiger Wert
+	 */
+	void setRange(const int16_t minimum, const int16_t maximum);
+
+	/**
+	 * @brief Übernimmt einen neuen Datensatz
+	 *
+	 * @param value Messwert
+	 * @param time Zeitpunkt der Messung in µs, z. B. micros()
+	 */
+	void update(const int16_t value, const unsigned long time);
+
+	/**
+	 * @brief Schätzt den Wert zum angegebenen Zeitpunkt
+	 *
+	 * @param time Zeitpunkt in µs, nicht vor dem letzten Datensatz
+	 * @return int16_t geschätzter Wert im gültigen Wertebereich
+	 */
+	const int16_t predict(const unsigned long time) const;
+
+	/**
+	 * @brief Verwirft alle bisherigen Datensätze
+	 */
+	void reset();
+
+private: // private Methoden
+	/**
+	 * @brief Schreibt die Änderungsrate über die angegebene Dauer fort
+	 *
+	 * @param velocity Änderungsrate (Q8 je 1024 µs)
+	 * @param elapsed Dauer in µs, höchstens MAX_GAP
+	 * @return int32_t Änderung des Werts (Q8)
+	 */
+	static const int32_t extrapolate(const int32_t velocity, const uint32_t elapsed);
+
+	/**
+	 * @brief Begrenzt einen Wert in Q8 auf den gültigen Wertebereich
+	 */
+	const int32_t limit(const int32_t value) const;
+
+private: // private Member
+	int16_t m_minimum; // kleinster gültiger Wert
+	int16_t m_maximum; // größter gültiger Wert
+	const uint16_t m_alpha; // Gewichtung für den Wert (Q8)
+	const uint16_t m_beta; // Gewichtung für die Änderungsrate (Q8)
+	uint32_t m_horizon; // Vorhersagehorizont in µs
+	int32_t m_position; // geschätzter Wert zum Zeitpunkt m_time (Q8)
+	int32_t m_velocity; // geschätzte Änderungsrate (Q8 je 1024 µs)
+	unsigned long m_time; // Zeitpunkt des letzten Datensatzes
+	bool m_initialized; // mindestens ein Datensatz liegt vor
+
+};
+
+/**
+ * @brief Vorhersage aller Joystick- und Beschleunigungswerte eines Nunchuks
+ */
+class MotionPredictor
+{
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse MotionPredictor.
+	 *
+	 * @param alpha Gewichtung der Abweichung für den Wert (Q8)
+	 * @param beta Gewichtung der Abweichung für die Änderungsrate (Q8)
+	 */
+	MotionPredictor(const uint16_t alpha = 224, const uint16_t beta = 128);
+
+	/**
+	 * @brief Setzt den Vorhersagehorizont aller Kanäle
+	 *
+	 * @param horizon Vorhersagehorizont in µs
+	 */
+	void setHorizon(const unsigned long horizon);
+
+	/**
+	 * @brief Liest das Gerät und übernimmt jeden empfangenen Datensatz. Unveränderte
+	 * 		  Datensätze werden ebenfalls übernommen, damit die Schätzung bei ruhendem
+	 * 		  Joystick nicht weiterläuft.
+	 *
+	 * @tparam Device Konfiguration von NunchukT
+	 * @param device Referenz auf das Gerät
+	 * @return State Rückgabewert von read()
+	 */
+	template<class Device>
+	State poll(Device &device)
+	{
+		const State state = device.read();
+
+		if (state == State::CONNECTED)
+		{
+			update(device, micros());
+		}
+		return state;
+	}
+
+	/**
+	 * @brief Übernimmt den aktuellen Datensatz eines Geräts. Der Wertebereich des Joysticks
+	 * 		  folgt dem aktuellen Mittenwert des Geräts.
+	 *
+	 * @tparam Device Konfiguration von NunchukT
+	 * @param device Referenz auf das Gerät
+	 * @param time Zeitpunkt der Messung in µs
+	 */
+	template<class Device>
+	void update(const Device &device, const unsigned long time)
+	{
+		const int16_t centerX = device.joystickCenterX();
+		const int16_t centerY = device.joystickCenterY();
+
+		m_joystickX.setRange(-centerX, 0xFF - centerX);
+		m_joystickY.setRange(-centerY, 0xFF - centerY);
+		m_joystickX.update(device.decodeJoystickX(), time);
+		m_joystickY.update(device.decodeJoystickY(), time);
+		m_accelerationX.update(device.decodeAccelerationX(), time);
+		m_accelerationY.update(device.decodeAccelerationY(), time);
+		m_accelerationZ.update(device.decodeAccelerationZ(), time);
+	}
+
+	const int16_t joystickX(const unsigned long time) const;
+	const int16_t joystickY(const unsigned long time) const;
+	const int16_t accelerationX(const unsigned long time) const;
+	const int16_t accelerationY(const unsigned long time) const;
+	const int16_t accelerationZ(const unsigned long time) const;
+
+	/**
+	 * @brief Verwirft alle bisherigen Datensätze, z. B. nach einem Neuverbinden
+	 */
+	void reset();
+
+private: // private Member
+	AlphaBetaPredictor m_joystickX; // Joystick links <-> rechts
+	AlphaBetaPredictor m_joystickY; // Joystick unten <-> oben
+	AlphaBetaPredictor m_accelerationX; // Beschleunigung in X-Richtung
+	AlphaBetaPredictor m_accelerationY; // Beschleunigung in Y-Richtung
+	AlphaBetaPredictor m_accelerationZ; // Beschleunigung in Z-Richtung
+
+};
+
+} // namespace communication
+
+#endif // !PREDICTOR_H
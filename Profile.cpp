@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Profile.h"
+
+#include <Arduino.h>
+
+#ifdef NUNCHUK_HAS_EEPROM
+#include <EEPROM.h>
+#endif
+
+namespace communication
+{
+	void Profile::seal()
+	{
+		version = VERSION;
+		crc = crc16(reinterpret_cast<const uint8_t *>(this), offsetof(Profile, crc));
+	}
+
+	const bool Profile::isValid() const
+	{
+		return (version == VERSION)
+			&& (crc == crc16(reinterpret_cast<const uint8_t *>(this), offsetof(Profile, crc)));
+	}
+
+	const bool Profile::matches(const uint8_t (&deviceId)[LEN_ID], const uint16_t calibrationCrc) const
+	{
+		return (memcmp(id, deviceId, LEN_ID) == 0) && (calibration == calibrationCrc);
+	}
+
+	uint16_t Profile::crc16(const uint8_t *data, const size_t length)
+	{
+		uint16_t crc = 0xFFFF;
+
+		for (size_t i = 0; i < length; i++)
+		{
+			crc ^= static_cast<uint16_t>(data[i]) << 8;
+
+			for (uint8_t bit = 0; bit < 8; bit++)
+			{
+				crc = (crc & 0x8000) ? static_cast<uint16_t>((crc << 1) ^ 0x1021) : static_cast<uint16_t>(crc << 1);
+			}
+		}
+
+		return crc;
+	}
+
+	ProfileSupport::ProfileSupport()
+	: m_storage{nullptr},
+	  m_address{0},
+	  m_calibration{0},
+	  m_id{},
+	  m_loaded{false}
+	{
+
+	}
+
+	void ProfileSupport::attach(ProfileStorage &storage, const uint16_t address)
+	{
+		m_storage = &storage;
+		m_address = address;
+	}
+
+	void ProfileSupport::setId(const uint8_t *id)
+	{
+		memcpy(m_id, id, Profile::LEN_ID);
+	}
+
+	void ProfileSupport::setCalibration(const uint8_t *calibration, const uint8_t length)
+	{
+		m_calibration = Profile::crc16(calibration, length);
+	}
+
+	const bool ProfileSupport::restore(uint8_t &joystickXNull, uint8_t &joystickYNull, uint8_t &deadzone, uint16_t &gap)
+	{
+		Profile profile;
+
+		m_loaded = m_storage
+			&& m_storage->load(m_address, profile)
+			&& profile.isValid()
+			&& profile.matches(m_id, m_calibration);
+
+		if (m_loaded)
+		{
+			joystickXNull = profile.joystickXNull;
+			joystickYNull = profile.joystickYNull;
+			deadzone = profile.deadzone;
+			gap = profile.gap;
+		}
+
+		return m_loaded;
+	}
+
+	const bool ProfileSupport::store(const uint8_t joystickXNull, const uint8_t joystickYNull, const uint8_t deadzone,
+		const uint16_t gap)
+	{
+		if (!m_storage)
+		{
+			return false;
+		}
+
+		Profile profile;
+		memcpy(profile.id, m_id, Profile::LEN_ID);
+		profile.joystickXNull = joystickXNull;
+		profile.joystickYNull = joystickYNull;
+		profile.deadzone = deadzone;
+		profile.calibration = m_calibration;
+		profile.gap = gap;
+		profile.seal();
+
+		return m_storage->store(m_address, profile);
+	}
+
+#ifdef NUNCHUK_HAS_EEPROM
+	const bool EepromStorage::read(const uint16_t address, uint8_t *data, const uint16_t length)
+	{
+		if (static_cast<uint32_t>(address) + length > EEPROM.length())
+		{
+			return false;
+		}
+
+		for (uint16_t i = 0; i < length; i++)
+		{
+			data[i] = EEPROM.read(address + i);
+		}
+		return true;
+	}
+
+	const bool EepromStorage::write(const uint16_t address, const uint8_t *data, const uint16_t length)
+	{
+		if (static_cast<uint32_t>(address) + length > EEPROM.length())
+		{
+			return false;
+		}
+
+		for (uint16_t i = 0; i < length; i++)
+		{
+			// schreibt nur geänderte Zellen und schont damit den EEPROM
+			EEPROM.update(address + i, data[i]);
+		}
+		return true;
+	}
+#endif
+} // namespace communication
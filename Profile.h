@@ -0,0 +1,302 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Profile.h
+ *
+ * @brief  Versioniertes, CRC-geschütztes Geräteprofil (Kalibrierung und Einstellungen)
+ *         sowie Speicher im EEPROM bzw. ein emulierter EEPROM für Host-Builds
+ */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Geräteprofil eines Nunchuks, wie es im nichtflüchtigen Speicher abgelegt wird.
+ * 		  Alle Originalgeräte melden dieselbe ID, das Profil gilt daher nur für das Gerät mit
+ * 		  der gespeicherten ID und derselben Prüfsumme der Kalibrierungsdaten.
+ */
+struct Profile
+{
+	// aktuelle Version des Formats, bei Änderungen des Aufbaus erhöhen
+	static constexpr const uint8_t VERSION{3};
+
+	// Länge der Geräte-ID
+	static constexpr const uint8_t LEN_ID{6};
+
+	// Reihenfolge so gewählt, dass auch auf 32-Bit-Plattformen keine Füllbytes entstehen
+	uint8_t version; // Version des Formats
+	uint8_t id[LEN_ID]; // ID des Geräts, zu dem das Profil gehört
+	uint8_t joystickXNull; // Mittenwert des Joysticks (links <-> rechts)
+	uint8_t joystickYNull; // Mittenwert des Joysticks (oben <-> unten)
+	uint8_t deadzone; // Totbereich des Joysticks um die Mitte
+	uint16_t calibration; // CRC-16 der Kalibrierungsdaten des Geräts
+	uint16_t gap; // gemessener Mindestabstand vor dem Auslesen in µs, 0 falls nicht gemessen
+	uint16_t crc; // CRC-16 über alle vorherigen Felder
+
+	/**
+	 * @brief Setzt Version und Prüfsumme, danach darf das Profil gespeichert werden
+	 */
+	void seal();
+
+	/**
+	 * @brief Prüft Version und Prüfsumme
+	 *
+	 * @return true Profil ist gültig
+	 * @return false Profil fehlt, ist beschädigt oder hat ein anderes Format
+	 */
+	const bool isValid() const;
+
+	/**
+	 * @brief Prüft, ob das Profil zum Gerät mit der übergebenen ID und Kalibrierung gehört
+	 *
+	 * @param deviceId ID des Geräts
+	 * @param calibrationCrc CRC-16 der Kalibrierungsdaten des Geräts
+	 * @return true Profil gehört zum Gerät
+	 */
+	const bool matches(const uint8_t (&deviceId)[LEN_ID], const uint16_t calibrationCrc) const;
+
+	/**
+	 * @brief Berechnet die CRC-16 (CCITT, Startwert 0xFFFF) über einen Speicherbereich
+	 *
+	 * @param data Zeiger auf die Daten
+	 * @param length Anzahl der Bytes
+	 * @return uint16_t Prüfsumme
+	 */
+	static uint16_t crc16(const uint8_t *data, const size_t length);
+};
+
+/**
+ * @brief Schnittstelle eines nichtflüchtigen Speichers für Profile
+ */
+class ProfileStorage
+{
+public: // public Methoden
+	/**
+	 * @brief Liest einen zusammenhängenden Bereich
+	 *
+	 * @param address Startadresse
+	 * @param data Ziel der Daten
+	 * @param length Anzahl der Bytes
+	 * @return true Bereich gelesen
+	 * @return false Bereich außerhalb des Speichers
+	 */
+	virtual const bool read(const uint16_t address, uint8_t *data, const uint16_t length) = 0;
+
+	/**
+	 * @brief Schreibt einen zusammenhängenden Bereich, unveränderte Bytes werden nicht
+	 * 		  erneut geschrieben
+	 *
+	 * @param address Startadresse
+	 * @param data zu schreibende Daten
+	 * @param length Anzahl der Bytes
+	 * @return true Bereich geschrieben
+	 * @return false Bereich außerhalb des Speichers
+	 */
+	virtual const bool write(const uint16_t address, const uint8_t *data, const uint16_t length) = 0;
+
+	/**
+	 * @brief Liest ein Profil
+	 */
+	const bool load(const uint16_t address, Profile &profile)
+	{
+		return read(address, reinterpret_cast<uint8_t *>(&profile), sizeof(Profile));
+	}
+
+	/**
+	 * @brief Schreibt ein Profil
+	 */
+	const bool store(const uint16_t address, const Profile &profile)
+	{
+		return write(address, reinterpret_cast<const uint8_t *>(&profile), sizeof(Profile));
+	}
+};
+
+/**
+ * @brief Policy von NunchukT für Geräteprofile, siehe NunchukT::setProfileStorage().
+ * 		  Hält Speicher und Adresse sowie ID und Kalibrierung des verbundenen Geräts.
+ */
+class ProfileSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	ProfileSupport();
+
+	/**
+	 * @brief Legt Speicher und Adresse des Profils fest
+	 */
+	void attach(ProfileStorage &storage, const uint16_t address);
+
+	/**
+	 * @return true Speicher festgelegt
+	 */
+	const bool attached() const
+	{
+		return m_storage != nullptr;
+	}
+
+	/**
+	 * @return true beim letzten Verbindungsaufbau wurde ein passendes Profil geladen
+	 */
+	const bool loaded() const
+	{
+		return m_loaded;
+	}
+
+	/**
+	 * @brief Verwirft das geladene Profil, z. B. zu Beginn eines Verbindungsaufbaus
+	 */
+	void unload()
+	{
+		m_loaded = false;
+	}
+
+	/**
+	 * @brief Merkt sich die ID des verbundenen Geräts
+	 */
+	void setId(const uint8_t *id);
+
+	/**
+	 * @brief Merkt sich die Prüfsumme der Kalibrierungsdaten des verbundenen Geräts
+	 */
+	void setCalibration(const uint8_t *calibration, const uint8_t length);
+
+	/**
+	 * @brief Lädt das Profil und übernimmt seine Werte, falls es zu ID und Kalibrierung des
+	 * 		  verbundenen Geräts passt
+	 *
+	 * @param joystickXNull Mittenwert links <-> rechts, nur bei Erfolg überschrieben
+	 * @param joystickYNull Mittenwert unten <-> oben, nur bei Erfolg überschrieben
+	 * @param deadzone Totbereich, nur bei Erfolg überschrieben
+	 * @param gap gespeicherter Mindestabstand in µs (0 falls nicht gemessen), nur bei Erfolg
+	 * 		  überschrieben
+	 * @return true passendes Profil geladen
+	 */
+	const bool restore(uint8_t &joystickXNull, uint8_t &joystickYNull, uint8_t &deadzone, uint16_t &gap);
+
+	/**
+	 * @brief Speichert das Profil des verbundenen Geräts
+	 *
+	 * @return false kein Speicher festgelegt oder Schreiben fehlgeschlagen
+	 */
+	const bool store(const uint8_t joystickXNull, const uint8_t joystickYNull, const uint8_t deadzone,
+		const uint16_t gap);
+
+private: // private Member
+	ProfileStorage *m_storage; // Speicher des Profils, nullptr ohne Profil
+	uint16_t m_address; // Adresse des Profils im Speicher
+	uint16_t m_calibration; // CRC-16 der Kalibrierungsdaten des verbundenen Geräts
+	uint8_t m_id[Profile::LEN_ID]; // ID des verbundenen Geräts
+	bool m_loaded; // Profil passt zum verbundenen Gerät
+
+};
+
+#if defined(ARDUINO_ARCH_AVR)
+#define NUNCHUK_HAS_EEPROM 1
+
+/**
+ * @brief Profilspeicher im EEPROM von AVR-Controllern
+ */
+class EepromStorage : public ProfileStorage
+{
+public: // public Methoden
+	const bool read(const uint16_t address, uint8_t *data, const uint16_t length) override;
+	const bool write(const uint16_t address, const uint8_t *data, const uint16_t length) override;
+};
+
+#endif
+
+/**
+ * @brief Klassen-Template eines im RAM emulierten EEPROMs, z. B. für Host-Builds und Tests.
+ * 		  Zählt Lese- und Schreibzugriffe.
+ *
+ * @tparam Size Größe des Speichers in Byte
+ */
+template<
+	uint16_t Size
+>
+class EmulatedEeprom : public ProfileStorage
+{
+public: // public Methoden
+	/**
+	 * @brief Kontruiert einen gelöschten Speicher (alle Bytes 0xFF)
+	 */
+	EmulatedEeprom()
+	: m_reads{0},
+	  m_writes{0}
+	{
+		memset(m_data, 0xFF, Size);
+	}
+
+	const bool read(const uint16_t address, uint8_t *data, const uint16_t length) override
+	{
+		if (static_cast<uint32_t>(address) + length > Size)
+		{
+			return false;
+		}
+
+		memcpy(data, &m_data[address], length);
+		m_reads++;
+		return true;
+	}
+
+	const bool write(const uint16_t address, const uint8_t *data, const uint16_t length) override
+	{
+		if (static_cast<uint32_t>(address) + length > Size)
+		{
+			return false;
+		}
+
+		for (uint16_t i = 0; i < length; i++)
+		{
+			if (m_data[address + i] != data[i])
+			{
+				m_data[address + i] = data[i];
+				m_writes++;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * @brief Gibt die Anzahl der Lesevorgänge zurück
+	 */
+	const uint16_t reads() const
+	{
+		return m_reads;
+	}
+
+	/**
+	 * @brief Gibt die Anzahl tatsächlich geschriebener Bytes zurück
+	 */
+	const uint16_t writes() const
+	{
+		return m_writes;
+	}
+
+	/**
+	 * @brief Gibt direkten Zugriff auf den Speicher, z. B. um Fehler zu simulieren
+	 */
+	uint8_t *data()
+	{
+		return m_data;
+	}
+
+private: // private Member
+	uint8_t m_data[Size]; // Inhalt des Speichers
+	uint16_t m_reads; // Anzahl der Lesevorgänge
+	uint16_t m_writes; // Anzahl geschriebener Bytes
+};
+
+} // namespace communication
+
+#endif // !PROFILE_H
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Publisher.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	Mailbox::Mailbox()
+		: m_slot{},
+		m_fetched{0}
+	{
+	}
+
+	void Mailbox::post(const Reading &reading)
+	{
+		m_slot.write(reading);
+	}
+
+	const bool Mailbox::fetch(Reading &reading)
+	{
+		const uint8_t sequence = m_slot.sequence();
+
+		if (sequence == m_fetched)
+		{
+			return false;
+		}
+
+		m_slot.read(reading);
+		m_fetched = sequence;
+		return true;
+	}
+
+	Publisher::Publisher()
+		: m_subscribers{},
+		m_due{0},
+		m_fields{0},
+		m_sequence{0},
+		m_published{0},
+		m_decoded{0}
+	{
+	}
+
+	uint8_t Publisher::subscribe(const uint8_t divisor, const uint8_t fields, const ReadingDelegate delegate)
+	{
+		return add(divisor, fields, delegate, nullptr);
+	}
+
+	uint8_t Publisher::subscribe(const uint8_t divisor, const uint8_t fields, Mailbox &mailbox)
+	{
+		return add(divisor, fields, ReadingDelegate{}, &mailbox);
+	}
+
+	void Publisher::unsubscribe(const uint8_t id)
+	{
+		if (id >= MAX_SUBSCRIBERS)
+		{
+			return;
+		}
+
+		m_subscribers[id].active = false;
+		m_due &= ~(1 << id);
+	}
+
+	const bool Publisher::prepare()
+	{
+		m_fields = 0;
+		m_due = 0;
+		m_published++;
+
+		for (uint8_t id = 0; id < MAX_SUBSCRIBERS; id++)
+		{
+			Subscriber &subscriber = m_subscribers[id];
+
+			if (!subscriber.active || --subscriber.countdown != 0)
+			{
+				continue;
+			}
+
+			subscriber.countdown = subscriber.divisor;
+			m_due |= (1 << id);
+			m_fields |= subscriber.fields;
+		}
+
+		return m_due != 0;
+	}
+
+	const bool Publisher::prepareAll()
+	{
+		m_fields = 0;
+		m_due = 0;
+
+		for (uint8_t id = 0; id < MAX_SUBSCRIBERS; id++)
+		{
+			if (m_subscribers[id].active)
+			{
+				m_due |= (1 << id);
+				m_fields |= m_subscribers[id].fields;
+			}
+		}
+
+		return m_due != 0;
+	}
+
+	const uint8_t Publisher::fields() const
+	{
+		return m_fields;
+	}
+
+	void Publisher::deliver(Reading &reading)
+	{
+		reading.sequence = m_sequence++;
+		m_decoded++;
+
+		for (uint8_t id = 0; id < MAX_SUBSCRIBERS; id++)
+		{
+			Subscriber &subscriber = m_subscribers[id];
+
+			if (!(m_due & (1 << id)))
+			{
+				continue;
+			}
+
+			if (subscriber.mailbox)
+			{
+				subscriber.mailbox->post(reading);
+			}
+			else if (subscriber.delegate)
+			{
+				subscriber.delegate(reading);
+			}
+			subscriber.deliveries++;
+		}
+
+		m_due = 0;
+	}
+
+	const uint32_t Publisher::deliveries(const uint8_t id) const
+	{
+		return (id < MAX_SUBSCRIBERS) ? m_subscribers[id].deliveries : 0;
+	}
+
+	const uint32_t Publisher::decoded() const
+	{
+		return m_decoded;
+	}
+
+	const uint32_t Publisher::published() const
+	{
+		return m_published;
+	}
+
+	uint8_t Publisher::add(const uint8_t divisor, const uint8_t fields, const ReadingDelegate delegate,
+		Mailbox *mailbox)
+	{
+		for (uint8_t id = 0; id < MAX_SUBSCRIBERS; id++)
+		{
+			Subscriber &subscriber = m_subscribers[id];
+
+			if (subscriber.active)
+			{
+				continue;
+			}
+
+			subscriber.delegate = delegate;
+			subscriber.mailbox = mailbox;
+			subscriber.deliveries = 0;
+			subscriber.divisor = (divisor == 0) ? 1 : divisor;
+			// erste Zustellung mit dem nächsten neuen Datensatz
+			subscriber.countdown = 1;
+			subscriber.fields = fields;
+			subscriber.active = true;
+			return id;
+		}
+
+		return INVALID_SUBSCRIBER;
+	}
+} // namespace communication
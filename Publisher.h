@@ -0,0 +1,330 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Publisher.h
+ *
+ * @brief  Klassendefinitionen zur Verteilung dekodierter Datensätze an mehrere
+ *         Abonnenten mit eigener Rate und Feldauswahl
+ */
+
+#ifndef PUBLISHER_H
+#define PUBLISHER_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+#include "Delegate.h"
+#include "SeqLock.h"
+
+namespace communication
+{
+
+// Felder eines dekodierten Datensatzes, als Bitmaske kombinierbar
+namespace Field
+{
+	using FieldConstant = const uint8_t;
+
+	// Gedrücktzustand der Buttons (entprellt, sofern ButtonDebounce verwendet wird)
+	constexpr FieldConstant BUTTONS{0x01};
+
+	// Auslenkung des Joysticks relativ zur Mitte, mit Totbereich
+	constexpr FieldConstant JOYSTICK{0x02};
+
+	// ungefilterte Beschleunigungswerte
+	constexpr FieldConstant ACCELERATION{0x04};
+
+	// Ausgabewerte der Filter-Policy
+	constexpr FieldConstant FILTERED{0x08};
+
+	// alle Felder
+	constexpr FieldConstant ALL{0x0F};
+};
+
+/**
+ * @brief Einmal je neuem Datensatz dekodierte Werte. Gültig sind nur die in fields gesetzten
+ * Felder, d. h. die Vereinigung der Felder aller in diesem Datensatz bedienten Abonnenten.
+ */
+struct Reading
+{
+	unsigned long time; // Zeitpunkt des Empfangs in µs
+	uint16_t sequence; // fortlaufende Nummer der veröffentlichten Datensätze
+	uint8_t fields; // gültige Felder, siehe Field
+	bool buttonC; // Button C gedrückt
+	bool buttonZ; // Button Z gedrückt
+	int16_t joystickX; // Auslenkung des Joysticks (links <-> rechts)
+	int16_t joystickY; // Auslenkung des Joysticks (oben <-> unten)
+	int16_t accelerationX; // Beschleunigung (links <-> rechts)
+	int16_t accelerationY; // Beschleunigung (vor <-> zurück)
+	int16_t accelerationZ; // Beschleunigung (oben <-> unten)
+	int16_t filteredX; // gefilterte Beschleunigung (links <-> rechts)
+	int16_t filteredY; // gefilterte Beschleunigung (vor <-> zurück)
+	int16_t filteredZ; // gefilterte Beschleunigung (oben <-> unten)
+};
+
+// Delegat eines Abonnenten, wird innerhalb von read() aufgerufen
+using ReadingDelegate = Delegate<void(const Reading &)>;
+
+/**
+ * @brief Briefkasten eines Abonnenten, der in einem anderen Kontext (Task, ISR, spätere
+ * Phase von loop()) liest. Enthält nur den jeweils neuesten Datensatz, ältere werden
+ * überschrieben.
+ */
+class Mailbox
+{
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse Mailbox. Der Briefkasten ist leer.
+	 */
+	Mailbox();
+
+	/**
+	 * @brief Legt einen Datensatz ab (nur Publisher)
+	 *
+	 * @param reading Referenz auf den Datensatz
+	 */
+	void post(const Reading &reading);
+
+	/**
+	 * @brief Entnimmt den neuesten Datensatz, sofern seit der letzten Entnahme einer
+	 * abgelegt wurde. Kann ohne Sperren aufgerufen werden.
+	 *
+	 * @param reading Referenz auf das Ziel
+	 * @return true neuer Datensatz entnommen
+	 * @return false kein neuer Datensatz
+	 */
+	const bool fetch(Reading &reading);
+
+private: // private Member
+	SeqLock<Reading> m_slot; // zuletzt abgelegter Datensatz
+	uint8_t m_fetched; // Sequenznummer des Puffers bei der letzten Entnahme
+
+};
+
+/**
+ * @brief Verteilt die Datensätze eines Nunchuks an mehrere Abonnenten (z. B. Motorregelung,
+ * Anzeige, Telemetrie, Protokollierung). Jeder Abonnent erhält nur jeden divisor-ten neuen
+ * Datensatz und nennt die benötigten Felder. Je Datensatz dekodiert der Nunchuk nur die
+ * Felder der fälligen Abonnenten, und das nur einmal; ist kein Abonnent fällig, entfällt
+ * die Dekodierung ganz.
+ *
+ * Unveränderte und verworfene Datensätze werden nicht verteilt und zählen nicht mit.
+ */
+class Publisher
+{
+
+public: // public static Member
+	// maximale Anzahl der Abonnenten
+	static constexpr const uint8_t MAX_SUBSCRIBERS{6};
+
+	// Kennung eines ungültigen bzw. nicht registrierten Abonnenten
+	static constexpr const uint8_t INVALID_SUBSCRIBER{0xFF};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse Publisher.
+	 */
+	Publisher();
+
+	/**
+	 * @brief Registriert einen Abonnenten mit Delegat
+	 *
+	 * @param divisor jeder wievielte neue Datensatz zugestellt wird, 0 entspricht 1
+	 * @param fields benötigte Felder, siehe Field
+	 * @param delegate aufzurufender Delegat
+	 * @return uint8_t Kennung des Abonnenten, INVALID_SUBSCRIBER falls kein Platz mehr frei ist
+	 */
+	uint8_t subscribe(const uint8_t divisor, const uint8_t fields, const ReadingDelegate delegate);
+
+	/**
+	 * @brief Registriert einen Abonnenten mit Briefkasten
+	 *
+	 * @param divisor jeder wievielte neue Datensatz zugestellt wird, 0 entspricht 1
+	 * @param fields benötigte Felder, siehe Field
+	 * @param mailbox Briefkasten, muss den Publisher überdauern
+	 * @return uint8_t Kennung des Abonnenten, INVALID_SUBSCRIBER falls kein Platz mehr frei ist
+	 */
+	uint8_t subscribe(const uint8_t divisor, const uint8_t fields, Mailbox &mailbox);
+
+	/**
+	 * @brief Meldet einen Abonnenten wieder ab
+	 *
+	 * @param id Kennung des Abonnenten
+	 */
+	void unsubscribe(const uint8_t id);
+
+	/**
+	 * @brief Zählt einen neuen Datensatz und bestimmt die fälligen Abonnenten (Nunchuk)
+	 *
+	 * @return true mindestens ein Abonnent ist fällig, der Datensatz ist zu dekodieren
+	 * @return false kein Abonnent fällig
+	 */
+	const bool prepare();
+
+	/**
+	 * @brief Bestimmt alle Abonnenten unabhängig von ihrem Teiler als fällig, ohne den
+	 * Datensatz zu zählen, z. B. für den neutralen Datensatz des Failsafe (Nunchuk)
+	 *
+	 * @return true mindestens ein Abonnent ist registriert
+	 */
+	const bool prepareAll();
+
+	/**
+	 * @brief Gibt die Vereinigung der Felder der in prepare() bestimmten Abonnenten zurück
+	 */
+	const uint8_t fields() const;
+
+	/**
+	 * @brief Stellt den dekodierten Datensatz den in prepare() bestimmten Abonnenten zu
+	 * (Nunchuk)
+	 *
+	 * @param reading Referenz auf den Datensatz, Feld sequence wird gesetzt
+	 */
+	void deliver(Reading &reading);
+
+	/**
+	 * @brief Gibt die Anzahl der Zustellungen an einen Abonnenten zurück
+	 *
+	 * @param id Kennung des Abonnenten
+	 */
+	const uint32_t deliveries(const uint8_t id) const;
+
+	/**
+	 * @brief Gibt die Anzahl der verteilten Datensätze zurück, für die mindestens ein
+	 * Abonnent fällig war (d. h. dekodiert wurde)
+	 */
+	const uint32_t decoded() const;
+
+	/**
+	 * @brief Gibt die Anzahl aller gezählten neuen Datensätze zurück
+	 */
+	const uint32_t published() const;
+
+private: // private Typen
+	/**
+	 * @brief Verwaltungsdaten eines Abonnenten
+	 */
+	struct Subscriber
+	{
+		ReadingDelegate delegate; // Delegat, leer bei Briefkasten
+		Mailbox *mailbox; // Briefkasten, nullptr bei Delegat
+		uint32_t deliveries; // Anzahl der Zustellungen
+		uint8_t divisor; // jeder wievielte Datensatz zugestellt wird
+		uint8_t countdown; // verbleibende Datensätze bis zur nächsten Zustellung
+		uint8_t fields; // benötigte Felder
+		bool active; // Abonnent ist registriert
+	};
+
+private: // private Methoden
+	/**
+	 * @brief Belegt einen freien Platz
+	 *
+	 * @return uint8_t Kennung des Abonnenten, INVALID_SUBSCRIBER falls kein Platz frei ist
+	 */
+	uint8_t add(const uint8_t divisor, const uint8_t fields, const ReadingDelegate delegate,
+		Mailbox *mailbox);
+
+private: // private Member
+	Subscriber m_subscribers[MAX_SUBSCRIBERS]; // registrierte Abonnenten
+	uint8_t m_due; // Bitmaske der in prepare() fälligen Abonnenten
+	uint8_t m_fields; // Felder der fälligen Abonnenten
+	uint16_t m_sequence; // Nummer des nächsten Datensatzes
+	uint32_t m_published; // gezählte neue Datensätze
+	uint32_t m_decoded; // dekodierte Datensätze
+
+};
+
+/**
+ * @brief Policy von NunchukT für die Verteilung an Abonnenten, siehe NunchukT::setPublisher()
+ */
+class PublisherSupport
+{
+public: // public static Member
+	static constexpr const bool ENABLED{true};
+
+public: // public Methoden
+	PublisherSupport()
+	: m_publisher{nullptr}
+	{
+
+	}
+
+	/**
+	 * @brief Legt den Publisher fest
+	 */
+	void attach(Publisher &publisher)
+	{
+		m_publisher = &publisher;
+	}
+
+	/**
+	 * @return true Publisher festgelegt
+	 */
+	const bool attached() const
+	{
+		return m_publisher != nullptr;
+	}
+
+	/**
+	 * @brief Dekodiert den aktuellen Datensatz des Geräts einmal, beschränkt auf die Felder der
+	 * 		  fälligen Abonnenten, und stellt ihn zu
+	 *
+	 * @tparam Device Gerät, z. B. NunchukT
+	 * @param device Gerät, dessen aktueller Datensatz verteilt wird
+	 * @param all alle Abonnenten unabhängig von ihrem Teiler, z. B. für den neutralen Datensatz
+	 */
+	template<class Device>
+	void distribute(const Device &device, const bool all)
+	{
+		if (!m_publisher || !(all ? m_publisher->prepareAll() : m_publisher->prepare()))
+		{
+			return;
+		}
+
+		const auto frame = device.snapshot();
+		const uint8_t fields = m_publisher->fields();
+		Reading reading{};
+		reading.time = Clock::now();
+		reading.fields = fields;
+
+		if (fields & Field::BUTTONS)
+		{
+			reading.buttonC = device.pressedC();
+			reading.buttonZ = device.pressedZ();
+		}
+
+		if (fields & Field::JOYSTICK)
+		{
+			reading.joystickX = device.decodeJoystickX();
+			reading.joystickY = device.decodeJoystickY();
+		}
+
+		if (fields & Field::ACCELERATION)
+		{
+			reading.accelerationX = frame.decodeAccelerationX();
+			reading.accelerationY = frame.decodeAccelerationY();
+			reading.accelerationZ = frame.decodeAccelerationZ();
+		}
+
+		// nach dem Auslösen des Failsafe 0 wie der neutrale Datensatz
+		if (fields & Field::FILTERED)
+		{
+			reading.filteredX = device.filteredAccelerationX();
+			reading.filteredY = device.filteredAccelerationY();
+			reading.filteredZ = device.filteredAccelerationZ();
+		}
+
+		m_publisher->deliver(reading);
+	}
+
+private: // private Member
+	Publisher *m_publisher; // Publisher, nullptr ohne Abonnenten
+
+};
+
+} // namespace communication
+
+#endif // !PUBLISHER_H
@@ -0,0 +1,208 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Klassen-Template einer doppelt gepufferten Sequenzsperre (Seqlock).
+ * Ein einzelner Schreiber füllt den inaktiven Puffer und veröffentlicht ihn anschließend
+ * durch Inkrementieren der Sequenznummer. Leser kopieren den aktiven Puffer und wiederholen
+ * den Vorgang, falls währenddessen eine neue Veröffentlichung stattgefunden hat.
+ * Schreiber und Leser warten nicht aufeinander, daher darf jede Seite auch aus einer ISR
+ * heraus aufgerufen werden. Nur der Zähler der Wiederholungen wird auf AVR für wenige Takte
+ * unter gesperrten Interrupts aktualisiert.
+ *
+ * @tparam T trivial kopierbarer Datentyp der veröffentlichten Elemente
+ */
+template<
+	class T
+>
+class SeqLock
+{
+	public: // public typedefs
+		using value_type = T;
+
+		using reference = T&;
+		using const_reference = const T&;
+
+	public: // public static Member
+		// Anzahl der Versuche von read(T&), bevor die Kopie als ungültig gemeldet wird
+		static constexpr const uint8_t MAX_RETRIES{0xFF};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der SeqLock Klasse
+		 */
+		SeqLock()
+		: m_data{},
+		  m_sequence{0},
+		  m_retries{0}
+		{
+
+		}
+
+		/**
+		 * @brief Gibt Referenz auf den inaktiven Puffer zurück, der vom Schreiber befüllt
+		 * werden darf. Der Inhalt wird erst mit publish() für Leser sichtbar.
+		 *
+		 * @return T& Referenz auf den inaktiven Puffer
+		 */
+		T &back()
+		{
+			return m_data[(m_sequence + 1) & 0x01];
+		}
+
+		/**
+		 * @brief Gibt Referenz auf den aktuell veröffentlichten Puffer zurück.
+		 * Darf nur vom Schreiber verwendet werden, Leser verwenden read().
+		 *
+		 * @return const T& Referenz auf den aktiven Puffer
+		 */
+		const T &front() const
+		{
+			return m_data[m_sequence & 0x01];
+		}
+
+		/**
+		 * @brief Veröffentlicht den inaktiven Puffer als neuen aktuellen Wert
+		 */
+		void publish()
+		{
+			fence();
+			m_sequence = m_sequence + 1;
+			fence();
+		}
+
+		/**
+		 * @brief Schreibt einen Wert in den inaktiven Puffer und veröffentlicht ihn
+		 *
+		 * @param value Referenz auf zu schreibenden Wert
+		 */
+		void write(const T& value)
+		{
+			back() = value;
+			publish();
+		}
+
+		/**
+		 * @brief Erstellt eine Kopie des aktuell veröffentlichten Wertes. Veröffentlicht der
+		 * Schreiber während des Kopierens, wird bis zu MAX_RETRIES mal wiederholt.
+		 *
+		 * @param value Referenz auf das Ziel der Kopie
+		 * @return true Kopie ist konsistent
+		 * @return false Schreiber hat bei jedem Versuch veröffentlicht, Kopie ist ungültig
+		 */
+		const bool read(T& value) const
+		{
+			uint8_t retries = 0;
+			uint8_t sequence;
+			bool consistent;
+
+			do
+			{
+				sequence = m_sequence;
+				fence();
+				value = m_data[sequence & 0x01];
+				fence();
+				consistent = (sequence == m_sequence);
+			}
+			while (!consistent && (++retries < MAX_RETRIES));
+
+			// gleichzeitige Leser zählen ohne gegenseitige Überschreibung
+			if (retries != 0)
+			{
+				countRetries(retries);
+			}
+
+			return consistent;
+		}
+
+		/**
+		 * @brief Gibt eine Kopie des aktuell veröffentlichten Wertes zurück. Wie read(T&)
+		 * höchstens MAX_RETRIES Versuche, ein vom Schreiber verdrängter Leser hängt also nicht.
+		 * Misslingen alle Versuche, wird die letzte Kopie zurückgegeben; wer das erkennen muss,
+		 * verwendet read(T&).
+		 *
+		 * @return T Kopie des aktuellen Wertes
+		 */
+		T read() const
+		{
+			T value;
+			read(value);
+			return value;
+		}
+
+		/**
+		 * @brief Gibt die Sequenznummer der letzten Veröffentlichung zurück
+		 *
+		 * @return uint8_t Sequenznummer (läuft über)
+		 */
+		uint8_t sequence() const
+		{
+			return m_sequence;
+		}
+
+		/**
+		 * @brief Gibt die Summe aller Lesewiederholungen seit dem Start zurück
+		 *
+		 * @return uint32_t Anzahl der Wiederholungen
+		 */
+		uint32_t retries() const
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			// 4 Byte sind auf AVR nicht atomar lesbar
+			const uint8_t sreg = SREG;
+			cli();
+			const uint32_t retries = m_retries;
+			SREG = sreg;
+			return retries;
+#else
+			return __atomic_load_n(&m_retries, __ATOMIC_RELAXED);
+#endif
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Speicherbarriere, verhindert das Umsortieren von Zugriffen über die
+		 * Sequenznummer hinweg (auf AVR eine reine Compilerbarriere)
+		 */
+		static void fence()
+		{
+			__atomic_thread_fence(__ATOMIC_SEQ_CST);
+		}
+
+		/**
+		 * @brief Addiert Lesewiederholungen zum Zähler, auch aus einer ISR heraus
+		 *
+		 * @param retries Anzahl der Wiederholungen
+		 */
+		void countRetries(const uint8_t retries) const
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			// avr-gcc bietet keine atomaren 4-Byte-Operationen, daher mit gesperrten Interrupts
+			const uint8_t sreg = SREG;
+			cli();
+			m_retries += retries;
+			SREG = sreg;
+#else
+			__atomic_fetch_add(&m_retries, static_cast<uint32_t>(retries), __ATOMIC_RELAXED);
+#endif
+		}
+
+	private: // private Member
+		T m_data[2]; // aktiver und inaktiver Puffer
+		volatile uint8_t m_sequence; // Sequenznummer, Bit 0 wählt den aktiven Puffer
+		mutable uint32_t m_retries; // Summe der Lesewiederholungen, nur atomar zugreifen
+};
+
+} // namespace communication
+
+#endif // !SEQ_LOCK_H
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef SIMULATED_BUS_H
+#define SIMULATED_BUS_H
+
+#include <Arduino.h>
+
+#include "SimulatedNunchuk.h"
+
+namespace communication
+{
+
+/**
+ * @brief Bus-Policy, die statt eines realen Busses einen SimulatedNunchuk anspricht. Stellt
+ * dieselbe Schnittstelle wie WireBus bereit, sodass Treiber, Scheduler und Anwendung ohne
+ * angeschlossenes Gerät geprüft werden können, z. B.
+ * NunchukT<SimulatedBus, NoLevelShifter, ButtonDebounce, NoFilter, NoCycleTimer>.
+ *
+ * Die Übertragungsdauer aus Taktfrequenz und Anzahl der Bits (9 je Byte inkl. ACK, Start und
+ * Stopp) wird mit delayMicroseconds() nachgebildet. Ohne zugeordnetes Gerät und für andere
+ * Adressen verhält sich der Bus wie ohne angeschlossenen Slave.
+ */
+class SimulatedBus
+{
+	public: // public static Member
+
+		// Größe der Sende- und Empfangspuffer wie bei Wire
+		static constexpr const uint8_t BUFFER_LENGTH{32};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der SimulatedBus Klasse mit 100 kHz ohne Gerät
+		 */
+		SimulatedBus()
+		: m_device{nullptr},
+		  m_clock{100000},
+		  m_address{0},
+		  m_txBuffer{},
+		  m_txLength{0},
+		  m_txOverflow{false},
+		  m_rxBuffer{},
+		  m_rxLength{0},
+		  m_rxIndex{0}
+		{
+
+		}
+
+		/**
+		 * @brief Ordnet das simulierte Gerät zu, das unter Control::ADDR_NUNCHUK antwortet
+		 *
+		 * @param device Referenz auf das Gerät
+		 */
+		void attach(SimulatedNunchuk &device)
+		{
+			m_device = &device;
+		}
+
+		/**
+		 * @brief Trennt das simulierte Gerät vom Bus
+		 */
+		void detach()
+		{
+			m_device = nullptr;
+		}
+
+		void begin()
+		{
+
+		}
+
+		void end()
+		{
+
+		}
+
+		void setClock(const uint32_t clock)
+		{
+			m_clock = (clock > 0) ? clock : 100000;
+		}
+
+		/**
+		 * @brief Gibt die eingestellte Taktfrequenz zurück
+		 *
+		 * @return uint32_t Taktfrequenz in Hz
+		 */
+		uint32_t clock() const
+		{
+			return m_clock;
+		}
+
+		void beginTransmission(const uint8_t address)
+		{
+			m_address = address;
+			m_txLength = 0;
+			m_txOverflow = false;
+		}
+
+		size_t write(const uint8_t data)
+		{
+			if (m_txLength >= BUFFER_LENGTH)
+			{
+				m_txOverflow = true;
+				return 0;
+			}
+
+			m_txBuffer[m_txLength++] = data;
+			return 1;
+		}
+
+		uint8_t endTransmission(const bool stop = true)
+		{
+			(void)stop;
+
+			if (m_txOverflow)
+			{
+				return WireReturnCode::DATA_TOO_LONG;
+			}
+
+			transfer(m_txLength);
+
+			if (!m_device || m_address != Control::ADDR_NUNCHUK)
+			{
+				return WireReturnCode::NACK_ON_ADDR;
+			}
+
+			return m_device->write(m_txBuffer, m_txLength);
+		}
+
+		uint8_t requestFrom(const uint8_t address, const uint8_t quantity)
+		{
+			const uint8_t length = (quantity > BUFFER_LENGTH) ? BUFFER_LENGTH : quantity;
+
+			m_rxIndex = 0;
+			m_rxLength = 0;
+
+			// das Gerät muss die Daten direkt nach der Adresse bereitstellen
+			transfer(0);
+
+			if (m_device && address == Control::ADDR_NUNCHUK)
+			{
+				m_rxLength = m_device->read(m_rxBuffer, length);
+			}
+
+			wait(length * 9UL);
+			return m_rxLength;
+		}
+
+		int available()
+		{
+			return m_rxLength - m_rxIndex;
+		}
+
+		int read()
+		{
+			return (m_rxIndex < m_rxLength) ? m_rxBuffer[m_rxIndex++] : -1;
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Wartet die Übertragungsdauer von Adresse und Daten ab
+		 *
+		 * @param length Anzahl der Datenbytes
+		 */
+		void transfer(const uint8_t length) const
+		{
+			wait((length + 1UL) * 9UL + 2UL);
+		}
+
+		/**
+		 * @brief Wartet die Übertragungsdauer einer Anzahl Bits ab
+		 */
+		void wait(const uint32_t bits) const
+		{
+			delayMicroseconds(static_cast<unsigned int>((bits * 1000000UL) / m_clock));
+		}
+
+	private: // private Member
+		SimulatedNunchuk *m_device; // zugeordnetes Gerät
+		uint32_t m_clock; // Taktfrequenz in Hz
+		uint8_t m_address; // Adresse der laufenden Übertragung
+		uint8_t m_txBuffer[BUFFER_LENGTH]; // Sendepuffer
+		uint8_t m_txLength; // Anzahl der Bytes im Sendepuffer
+		bool m_txOverflow; // Sendepuffer übergelaufen
+		uint8_t m_rxBuffer[BUFFER_LENGTH]; // Empfangspuffer
+		uint8_t m_rxLength; // Anzahl der empfangenen Bytes
+		uint8_t m_rxIndex; // nächstes zu lesendes Byte
+};
+
+} // namespace communication
+
+#endif // !SIMULATED_BUS_H
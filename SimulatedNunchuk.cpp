@@ -0,0 +1,346 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "SimulatedNunchuk.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	SimulatedNunchuk::SimulatedNunchuk(const bool encryptedOnly)
+		: m_registers{},
+		m_pointer{0},
+		m_encryptedOnly{encryptedOnly},
+		m_initialized{false},
+		m_encrypted{false},
+		m_handshake{false},
+		m_input{},
+		m_delivered{},
+		m_sampleTime{0},
+		m_conversionTime{DEFAULT_CONVERSION_US},
+		m_staleReads{false},
+		m_noise{false},
+		m_previous{},
+		m_stuckSince{0},
+		m_stuck{false},
+		m_stuckDuration{100000},
+		m_timeout{DEFAULT_TIMEOUT_US},
+		m_latencySpike{2000},
+		m_rates{},
+		m_injected{},
+		m_transactions{0},
+		m_random{1}
+	{
+		memcpy(&m_registers[Control::REG_ID], Control::ID_NUNCHUK, Control::LEN_ID);
+		setCenter(Joystick::X_NULL, Joystick::Y_NULL);
+		setInput(Joystick::X_NULL, Joystick::Y_NULL, Acceleration::X_NULL, Acceleration::Y_NULL,
+			Acceleration::Z_NULL, false, false);
+	}
+
+	void SimulatedNunchuk::seed(const uint32_t value)
+	{
+		m_random = (value == 0) ? 1 : value;
+	}
+
+	void SimulatedNunchuk::setInput(const uint8_t joystickX, const uint8_t joystickY,
+		const uint16_t accelerationX, const uint16_t accelerationY, const uint16_t accelerationZ,
+		const bool buttonC, const bool buttonZ)
+	{
+		m_input.raw[0] = joystickX;
+		m_input.raw[1] = joystickY;
+		m_input.raw[2] = static_cast<uint8_t>(accelerationX >> 2);
+		m_input.raw[3] = static_cast<uint8_t>(accelerationY >> 2);
+		m_input.raw[4] = static_cast<uint8_t>(accelerationZ >> 2);
+		// Buttons low-aktiv, darüber die beiden niederwertigen Bits der Beschleunigung
+		m_input.raw[5] = (buttonZ ? 0 : Bitmask::BUTTON_Z_STATE)
+			| (buttonC ? 0 : Bitmask::BUTTON_C_STATE)
+			| ((accelerationX & 0x03) << 2)
+			| ((accelerationY & 0x03) << 4)
+			| ((accelerationZ & 0x03) << 6);
+	}
+
+	void SimulatedNunchuk::setCenter(const uint8_t x, const uint8_t y)
+	{
+		// Nullpunkt und 1 g der Beschleunigung, Maximum, Minimum und Mitte des Joysticks
+		const uint8_t calibration[Control::LEN_CAL_DATA - 2]{
+			0x80, 0x80, 0x80, 0x00, 0xB3, 0xB3, 0xB3, 0x00, 0xE0, 0x20, x, 0xE0, 0x20, y
+		};
+
+		uint8_t sum = 0;
+		for (uint8_t i = 0; i < Control::LEN_CAL_DATA - 2; i++)
+		{
+			sum += calibration[i];
+		}
+
+		// die Kalibrierungsdaten liegen zweimal hintereinander vor
+		for (uint8_t copy = 0; copy < 2; copy++)
+		{
+			uint8_t *target = &m_registers[Control::REG_CAL_DATA + copy * Control::LEN_CAL_DATA];
+
+			memcpy(target, calibration, Control::LEN_CAL_DATA - 2);
+			target[Control::LEN_CAL_DATA - 2] = static_cast<uint8_t>(sum + 0x55);
+			target[Control::LEN_CAL_DATA - 1] = static_cast<uint8_t>(sum + 0xAA);
+		}
+	}
+
+	void SimulatedNunchuk::setFaultRate(const SimulatedFault fault, const uint32_t ppm)
+	{
+		if (fault < SimulatedFault::COUNT)
+		{
+			m_rates[static_cast<uint8_t>(fault)] = (ppm > PPM) ? PPM : ppm;
+		}
+	}
+
+	void SimulatedNunchuk::clearFaults()
+	{
+		for (uint8_t i = 0; i < FAULTS; i++)
+		{
+			m_rates[i] = 0;
+		}
+		m_stuck = false;
+	}
+
+	void SimulatedNunchuk::setStuckDuration(const unsigned long us)
+	{
+		m_stuckDuration = us;
+	}
+
+	void SimulatedNunchuk::setTimeout(const unsigned long us)
+	{
+		m_timeout = us;
+	}
+
+	void SimulatedNunchuk::setLatencySpike(const unsigned long us)
+	{
+		m_latencySpike = us;
+	}
+
+	void SimulatedNunchuk::setConversionTime(const unsigned long us)
+	{
+		m_conversionTime = us;
+	}
+
+	void SimulatedNunchuk::setStaleReads(const bool stale)
+	{
+		m_staleReads = stale;
+	}
+
+	void SimulatedNunchuk::setNoise(const bool noise)
+	{
+		m_noise = noise;
+	}
+
+	void SimulatedNunchuk::powerCycle()
+	{
+		m_initialized = false;
+		m_encrypted = false;
+		m_handshake = false;
+		m_pointer = 0;
+	}
+
+	const uint8_t SimulatedNunchuk::write(const uint8_t *data, const uint8_t length)
+	{
+		m_transactions++;
+
+		if (disturb())
+		{
+			return WireReturnCode::TIMEOUT;
+		}
+
+		if (inject(SimulatedFault::NACK_ON_ADDR))
+		{
+			return WireReturnCode::NACK_ON_ADDR;
+		}
+
+		// reine Adressierung, z. B. beim Suchen nach Geräten
+		if (length == 0)
+		{
+			return WireReturnCode::SUCCESS;
+		}
+
+		if (inject(SimulatedFault::NACK_ON_DATA))
+		{
+			return WireReturnCode::NACK_ON_DATA;
+		}
+
+		m_pointer = data[0];
+
+		if (length == 1)
+		{
+			// Registerzeiger auf die Sensordaten startet die Wandlung
+			if (m_pointer == Control::REG_RAW_DATA)
+			{
+				sample();
+			}
+			return WireReturnCode::SUCCESS;
+		}
+
+		// nur die Steuerregister der Initialisierung werten geschriebene Daten aus
+		for (uint8_t i = 1; i < length; i++)
+		{
+			const uint8_t reg = m_pointer++;
+
+			if (reg == 0xF0)
+			{
+				m_handshake = (data[i] == 0x55);
+			}
+			else if (reg == 0xFB && data[i] == 0x00 && m_handshake && !m_encryptedOnly)
+			{
+				m_initialized = true;
+				m_encrypted = false;
+			}
+			else if (reg == Encryption::REG_INIT && data[i] == Encryption::VAL_INIT)
+			{
+				m_initialized = true;
+				m_encrypted = true;
+			}
+		}
+
+		return WireReturnCode::SUCCESS;
+	}
+
+	const uint8_t SimulatedNunchuk::read(uint8_t *data, const uint8_t length)
+	{
+		m_transactions++;
+
+		if (disturb() || inject(SimulatedFault::NACK_ON_ADDR))
+		{
+			return 0;
+		}
+
+		const uint8_t count = (length > 0 && inject(SimulatedFault::SHORT_READ))
+			? static_cast<uint8_t>(random() % length) : length;
+		const bool frame = (m_pointer == Control::REG_RAW_DATA);
+		const bool corrupt = frame && inject(SimulatedFault::CORRUPT_FRAME);
+		const bool converted = (micros() - m_sampleTime) >= m_conversionTime;
+		const bool valid = m_initialized && !corrupt;
+
+		for (uint8_t i = 0; i < count; i++)
+		{
+			const uint8_t reg = m_pointer++;
+			uint8_t value = 0xFF;
+
+			// Sensordaten erst nach Ende der Wandlung gültig
+			if (valid && (reg >= Control::LEN_RAW_DATA || converted))
+			{
+				value = m_registers[reg];
+			}
+			else if (valid && m_staleReads)
+			{
+				value = m_previous[reg];
+			}
+
+			// Umkehrung von Encryption::decrypt()
+			data[i] = m_encrypted ? static_cast<uint8_t>((value - 0x17) ^ 0x17) : value;
+		}
+
+		if (frame && valid && converted && count >= Control::LEN_RAW_DATA)
+		{
+			memcpy(m_delivered.raw, m_registers, Control::LEN_RAW_DATA);
+		}
+
+		return count;
+	}
+
+	const bool SimulatedNunchuk::isInitialized() const
+	{
+		return m_initialized;
+	}
+
+	const bool SimulatedNunchuk::isEncrypted() const
+	{
+		return m_encrypted;
+	}
+
+	const Frame &SimulatedNunchuk::deliveredFrame() const
+	{
+		return m_delivered;
+	}
+
+	const uint32_t SimulatedNunchuk::transactions() const
+	{
+		return m_transactions;
+	}
+
+	const uint32_t SimulatedNunchuk::injected(const SimulatedFault fault) const
+	{
+		return (fault < SimulatedFault::COUNT) ? m_injected[static_cast<uint8_t>(fault)] : 0;
+	}
+
+	const bool SimulatedNunchuk::inject(const SimulatedFault fault)
+	{
+		const uint8_t index = static_cast<uint8_t>(fault);
+
+		if (m_rates[index] == 0 || (random() % PPM) >= m_rates[index])
+		{
+			return false;
+		}
+
+		m_injected[index]++;
+		return true;
+	}
+
+	const bool SimulatedNunchuk::disturb()
+	{
+		if (m_stuck)
+		{
+			if ((micros() - m_stuckSince) < m_stuckDuration)
+			{
+				wait(m_timeout);
+				return true;
+			}
+			m_stuck = false;
+		}
+
+		if (inject(SimulatedFault::STUCK_BUS))
+		{
+			m_stuck = true;
+			m_stuckSince = micros();
+			wait(m_timeout);
+			return true;
+		}
+
+		if (inject(SimulatedFault::LATENCY_SPIKE))
+		{
+			wait(m_latencySpike);
+		}
+
+		if (inject(SimulatedFault::RESET))
+		{
+			powerCycle();
+		}
+
+		return false;
+	}
+
+	void SimulatedNunchuk::sample()
+	{
+		memcpy(m_previous, m_registers, Control::LEN_RAW_DATA);
+		memcpy(m_registers, m_input.raw, Control::LEN_RAW_DATA);
+		if (m_noise)
+		{
+			// Bits [7:2]: beide niederwertigen Bits der Beschleunigung in X, Y und Z
+			m_registers[Control::LEN_RAW_DATA - 1] ^= static_cast<uint8_t>(random() & 0xFC);
+		}
+		m_sampleTime = micros();
+	}
+
+	void SimulatedNunchuk::wait(const unsigned long us)
+	{
+		if (us >= 1000)
+		{
+			delay(us / 1000);
+		}
+		delayMicroseconds(static_cast<unsigned int>(us % 1000));
+	}
+
+	const uint32_t SimulatedNunchuk::random()
+	{
+		m_random ^= m_random << 13;
+		m_random ^= m_random >> 17;
+		m_random ^= m_random << 5;
+		return m_random;
+	}
+} // namespace communication
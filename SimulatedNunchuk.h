@@ -0,0 +1,332 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   SimulatedNunchuk.h
+ *
+ * @brief  Klassendefinition eines simulierten Nunchuks mit Registersatz,
+ *         Initialisierungssequenz, Zeitverhalten und einstellbarer Fehlerinjektion
+ */
+
+#ifndef SIMULATED_NUNCHUK_H
+#define SIMULATED_NUNCHUK_H
+
+#include <Arduino.h>
+
+#include "Nunchuk.h"
+
+namespace communication
+{
+
+/**
+ * @brief Arten der injizierbaren Fehler
+ */
+enum class SimulatedFault : uint8_t
+{
+	// Adresse wird nicht bestätigt (Gerät abgezogen)
+	NACK_ON_ADDR = 0,
+
+	// Daten werden nicht bestätigt
+	NACK_ON_DATA,
+
+	// Lesezugriff liefert weniger Bytes als angefordert
+	SHORT_READ,
+
+	// Bus bleibt für die eingestellte Dauer blockiert, alle Zugriffe laufen in die Zeitschranke
+	STUCK_BUS,
+
+	// Datensatz besteht nur aus 0xFF (z. B. halb gestecktes Kabel)
+	CORRUPT_FRAME,
+
+	// Zugriff dauert um die eingestellte Latenzspitze länger
+	LATENCY_SPIKE,
+
+	// Gerät verliert seine Initialisierung (z. B. Wackelkontakt der Versorgung)
+	RESET,
+
+	// Anzahl der Fehlerarten
+	COUNT
+};
+
+/**
+ * @brief Simulierter Nunchuk für SimulatedBus. Bildet den Registersatz (Sensordaten ab 0x00,
+ * Kalibrierung ab 0x20, ID ab 0xFA) mit automatisch inkrementiertem Registerzeiger nach, ebenso
+ * die Initialisierung im unverschlüsselten (0xF0 = 0x55, 0xFB = 0x00) und im verschlüsselten
+ * Modus (0x40 = 0x00). Ein nicht initialisiertes Gerät liefert nur 0xFF.
+ *
+ * Beim Setzen des Registerzeigers auf 0x00 werden die Eingänge abgetastet. Die Wandlung dauert
+ * die eingestellte Wandlungszeit, davor gelesene Sensordaten bestehen aus 0xFF.
+ *
+ * Jede Fehlerart tritt je Zugriff mit einer Wahrscheinlichkeit in Millionsteln auf, die Folge
+ * ist über seed() reproduzierbar. Zeitschranke und Latenzspitzen werden mit
+ * delayMicroseconds() nachgebildet.
+ */
+class SimulatedNunchuk
+{
+
+public: // public static Member
+	// Bezugsgröße der Fehlerwahrscheinlichkeiten (Millionstel)
+	static constexpr const uint32_t PPM{1000000UL};
+
+	// Anzahl der Fehlerarten
+	static constexpr const uint8_t FAULTS{static_cast<uint8_t>(SimulatedFault::COUNT)};
+
+	// voreingestellte Wandlungszeit nach dem Setzen des Registerzeigers auf 0x00 in µs
+	static constexpr const unsigned long DEFAULT_CONVERSION_US{100};
+
+	// voreingestellte Zeitschranke eines Zugriffs in µs (Wire auf AVR)
+	static constexpr const unsigned long DEFAULT_TIMEOUT_US{25000};
+
+public: // public Methoden
+	/**
+	 * @brief Konstruktor der Klasse SimulatedNunchuk. Das Gerät ist nicht initialisiert,
+	 * Joystick und Beschleunigung stehen in der Mitte, es sind keine Fehler aktiv.
+	 *
+	 * @param encryptedOnly true: Gerät unterstützt nur den verschlüsselten Modus (Nachbau)
+	 */
+	SimulatedNunchuk(const bool encryptedOnly = false);
+
+	/**
+	 * @brief Setzt den Startwert des Zufallsgenerators der Fehlerinjektion
+	 *
+	 * @param value Startwert, 0 wird durch 1 ersetzt
+	 */
+	void seed(const uint32_t value);
+
+	/**
+	 * @brief Setzt die Eingänge, die bei der nächsten Abtastung übernommen werden
+	 *
+	 * @param joystickX Joystick links <-> rechts (8 Bit)
+	 * @param joystickY Joystick oben <-> unten (8 Bit)
+	 * @param accelerationX Beschleunigung links <-> rechts (10 Bit)
+	 * @param accelerationY Beschleunigung vor <-> zurück (10 Bit)
+	 * @param accelerationZ Beschleunigung oben <-> unten (10 Bit)
+	 * @param buttonC true: Button C gedrückt
+	 * @param buttonZ true: Button Z gedrückt
+	 */
+	void setInput(const uint8_t joystickX, const uint8_t joystickY,
+		const uint16_t accelerationX, const uint16_t accelerationY, const uint16_t accelerationZ,
+		const bool buttonC, const bool buttonZ);
+
+	/**
+	 * @brief Setzt die Mittenwerte des Joysticks in den Kalibrierungsdaten (mit Prüfsumme)
+	 *
+	 * @param x Mittenwert links <-> rechts
+	 * @param y Mittenwert oben <-> unten
+	 */
+	void setCenter(const uint8_t x, const uint8_t y);
+
+	/**
+	 * @brief Setzt die Wahrscheinlichkeit einer Fehlerart je Zugriff
+	 *
+	 * @param fault Fehlerart
+	 * @param ppm Wahrscheinlichkeit in Millionsteln, 0 schaltet den Fehler ab
+	 */
+	void setFaultRate(const SimulatedFault fault, const uint32_t ppm);
+
+	/**
+	 * @brief Schaltet alle Fehlerarten ab, ein blockierter Bus wird sofort freigegeben
+	 */
+	void clearFaults();
+
+	/**
+	 * @brief Setzt die Dauer, für die der Bus nach einem Fehler STUCK_BUS blockiert bleibt
+	 *
+	 * @param us Dauer in µs
+	 */
+	void setStuckDuration(const unsigned long us);
+
+	/**
+	 * @brief Setzt die Zeitschranke, nach der ein Zugriff auf den blockierten Bus abbricht
+	 *
+	 * @param us Zeitschranke in µs
+	 */
+	void setTimeout(const unsigned long us);
+
+	/**
+	 * @brief Setzt die zusätzliche Dauer eines Zugriffs bei einem Fehler LATENCY_SPIKE
+	 *
+	 * @param us Latenzspitze in µs
+	 */
+	void setLatencySpike(const unsigned long us);
+
+	/**
+	 * @brief Setzt die Wandlungszeit nach dem Setzen des Registerzeigers auf 0x00
+	 *
+	 * @param us Wandlungszeit in µs
+	 */
+	void setConversionTime(const unsigned long us);
+
+	/**
+	 * @brief Legt fest, was vor dem Ende der Wandlung gelesen wird: der vorherige Datensatz
+	 * (veraltet, wie bei einigen Nachbauten) oder 0xFF (Standard)
+	 *
+	 * @param stale vorherigen Datensatz liefern
+	 */
+	void setStaleReads(const bool stale);
+
+	/**
+	 * @brief Schaltet das Rauschen der Beschleunigungswerte (beide niederwertigen Bits jeder
+	 * Achse zufällig) ein oder aus, wie bei einem ruhenden echten Gerät
+	 *
+	 * @param noise Rauschen ein
+	 */
+	void setNoise(const bool noise);
+
+	/**
+	 * @brief Versetzt das Gerät in den nicht initialisierten Zustand, wie nach dem Einstecken
+	 */
+	void powerCycle();
+
+	/**
+	 * @brief Führt einen schreibenden Zugriff aus. Das erste Byte setzt den Registerzeiger,
+	 * weitere Bytes werden in die Steuerregister geschrieben.
+	 *
+	 * @param data Zeiger auf die gesendeten Bytes
+	 * @param length Anzahl der gesendeten Bytes
+	 * @return uint8_t Rückgabewert wie Wire.endTransmission()
+	 */
+	const uint8_t write(const uint8_t *data, const uint8_t length);
+
+	/**
+	 * @brief Führt einen lesenden Zugriff ab dem Registerzeiger aus
+	 *
+	 * @param data Zeiger auf das Ziel
+	 * @param length Anzahl der angeforderten Bytes
+	 * @return uint8_t Anzahl der gelieferten Bytes
+	 */
+	const uint8_t read(uint8_t *data, const uint8_t length);
+
+	/**
+	 * @brief Gibt zurück, ob das Gerät initialisiert ist
+	 */
+	const bool isInitialized() const;
+
+	/**
+	 * @brief Gibt zurück, ob das Gerät im verschlüsselten Modus arbeitet
+	 */
+	const bool isEncrypted() const;
+
+	/**
+	 * @brief Gibt den zuletzt vollständig und fehlerfrei gelesenen Datensatz unverschlüsselt
+	 * zurück, d. h. den Datensatz, den der Treiber zuletzt hätte veröffentlichen müssen
+	 */
+	const Frame &deliveredFrame() const;
+
+	/**
+	 * @brief Gibt die Anzahl der Zugriffe zurück
+	 */
+	const uint32_t transactions() const;
+
+	/**
+	 * @brief Gibt die Anzahl der injizierten Fehler einer Fehlerart zurück
+	 *
+	 * @param fault Fehlerart
+	 */
+	const uint32_t injected(const SimulatedFault fault) const;
+
+private: // private Methoden
+	/**
+	 * @brief Entscheidet zufällig, ob ein Fehler injiziert wird, und zählt ihn
+	 *
+	 * @return true Fehler tritt auf
+	 */
+	const bool inject(const SimulatedFault fault);
+
+	/**
+	 * @brief Bildet die für alle Zugriffe gemeinsamen Fehler nach: blockierter Bus,
+	 * Latenzspitze und Verlust der Initialisierung
+	 *
+	 * @return true Bus blockiert, Zugriff ist nach der Zeitschranke abgebrochen
+	 */
+	const bool disturb();
+
+	/**
+	 * @brief Tastet die Eingänge ab und legt den Datensatz in den Registern 0x00 bis 0x05 ab
+	 */
+	void sample();
+
+	/**
+	 * @brief Wartet die übergebene Dauer, auch oberhalb des Wertebereichs von
+	 * delayMicroseconds()
+	 */
+	static void wait(const unsigned long us);
+
+	/**
+	 * @brief Xorshift-Zufallsgenerator
+	 */
+	const uint32_t random();
+
+private: // private Member
+	// Registersatz des Geräts (unverschlüsselt)
+	uint8_t m_registers[256];
+
+	// Registerzeiger
+	uint8_t m_pointer;
+
+	// nur verschlüsselter Modus möglich
+	const bool m_encryptedOnly;
+
+	// Gerät initialisiert
+	bool m_initialized;
+
+	// Gerät im verschlüsselten Modus
+	bool m_encrypted;
+
+	// erster Schritt der unverschlüsselten Initialisierung erfolgt
+	bool m_handshake;
+
+	// Eingänge für die nächste Abtastung
+	Frame m_input;
+
+	// zuletzt fehlerfrei gelesener Datensatz
+	Frame m_delivered;
+
+	// Zeitpunkt der letzten Abtastung in µs
+	unsigned long m_sampleTime;
+
+	// Wandlungszeit in µs
+	unsigned long m_conversionTime;
+
+	// vor dem Ende der Wandlung den vorherigen Datensatz liefern
+	bool m_staleReads;
+
+	// Rauschen der Beschleunigungswerte
+	bool m_noise;
+
+	// Sensordaten der vorherigen Abtastung
+	uint8_t m_previous[Control::LEN_RAW_DATA];
+
+	// Zeitpunkt, ab dem der Bus blockiert ist, in µs
+	unsigned long m_stuckSince;
+
+	// Bus blockiert
+	bool m_stuck;
+
+	// Dauer der Blockierung in µs
+	unsigned long m_stuckDuration;
+
+	// Zeitschranke eines Zugriffs in µs
+	unsigned long m_timeout;
+
+	// Dauer einer Latenzspitze in µs
+	unsigned long m_latencySpike;
+
+	// Wahrscheinlichkeiten der Fehlerarten in Millionsteln
+	uint32_t m_rates[FAULTS];
+
+	// Anzahl der injizierten Fehler je Fehlerart
+	uint32_t m_injected[FAULTS];
+
+	// Anzahl der Zugriffe
+	uint32_t m_transactions;
+
+	// Zustand des Zufallsgenerators
+	uint32_t m_random;
+};
+
+} // namespace communication
+
+#endif // !SIMULATED_NUNCHUK_H
@@ -0,0 +1,491 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef SOFT_WIRE_BUS_H
+#define SOFT_WIRE_BUS_H
+
+#include <Arduino.h>
+
+namespace communication
+{
+
+/**
+ * @brief Bus-Policy für eine in Software nachgebildete I2C-Schnittstelle (Bit-Banging) an
+ * beliebigen Pins. Stellt dieselbe Schnittstelle wie WireBus bereit, sodass ein weiterer
+ * Nunchuk ohne Multiplexer betrieben werden kann, z. B.
+ * NunchukT<SoftWireBus<4, 5>, OptionalLevelShifter, ButtonDebounce, NoFilter>.
+ *
+ * Die Leitungen werden als Open-Drain betrieben: Low durch Ausgang mit Pegel Low, High durch
+ * Umschalten auf Eingang. Externe Pull-up-Widerstände sind daher erforderlich.
+ * Auf AVR wird direkt auf die Portregister zugegriffen, auf anderen Architekturen dienen
+ * pinMode() und digitalRead() als Rückfallebene.
+ * Clock Stretching des Slaves wird bis zur Zeitschranke STRETCH_TIMEOUT_US abgewartet.
+ * Die Übertragung erfolgt blockierend, die CPU ist für die gesamte Dauer belegt.
+ *
+ * @tparam SdaPin Pin der Datenleitung
+ * @tparam SclPin Pin der Taktleitung
+ */
+template<
+	uint8_t SdaPin,
+	uint8_t SclPin
+>
+class SoftWireBus
+{
+	public: // public static Member
+
+		// Größe der Sende- und Empfangspuffer wie bei Wire
+		static constexpr const uint8_t BUFFER_LENGTH{32};
+
+		// maximale Dauer, die der Slave den Takt auf Low halten darf, in µs
+		static constexpr const uint16_t STRETCH_TIMEOUT_US{1000};
+
+		// Rückgabewerte von endTransmission(), identisch zu Wire
+		static constexpr const uint8_t SUCCESS{0};
+		static constexpr const uint8_t DATA_TOO_LONG{1};
+		static constexpr const uint8_t NACK_ON_ADDR{2};
+		static constexpr const uint8_t NACK_ON_DATA{3};
+		static constexpr const uint8_t OTHER{4};
+		static constexpr const uint8_t TIMEOUT{5};
+
+	public: // public Methoden
+		/**
+		 * @brief Kontruiert ein neues Objekt der SoftWireBus Klasse mit 100 kHz und ermittelt
+		 * die Portregister der Pins
+		 */
+		SoftWireBus()
+		:
+#if defined(ARDUINO_ARCH_AVR)
+		  m_sdaMode{portModeRegister(digitalPinToPort(SdaPin))},
+		  m_sdaIn{portInputRegister(digitalPinToPort(SdaPin))},
+		  m_sdaMask{digitalPinToBitMask(SdaPin)},
+		  m_sclMode{portModeRegister(digitalPinToPort(SclPin))},
+		  m_sclIn{portInputRegister(digitalPinToPort(SclPin))},
+		  m_sclMask{digitalPinToBitMask(SclPin)},
+#endif
+		  m_halfPeriod{5},
+		  m_address{0},
+		  m_txLength{0},
+		  m_txOverflow{false},
+		  m_rxBuffer{},
+		  m_rxLength{0},
+		  m_rxIndex{0},
+		  m_timedOut{false},
+		  m_timeouts{0}
+		{
+
+		}
+
+		/**
+		 * @brief Gibt beide Leitungen frei
+		 */
+		void begin()
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			// Ausgangspegel Low, interne Pull-ups aus
+			const uint8_t sreg = SREG;
+			cli();
+			*portOutputRegister(digitalPinToPort(SdaPin)) &= ~m_sdaMask;
+			*portOutputRegister(digitalPinToPort(SclPin)) &= ~m_sclMask;
+			SREG = sreg;
+#else
+			digitalWrite(SdaPin, LOW);
+			digitalWrite(SclPin, LOW);
+#endif
+			releaseSda();
+			releaseScl();
+		}
+
+		/**
+		 * @brief Gibt beide Leitungen frei
+		 */
+		void end()
+		{
+			releaseSda();
+			releaseScl();
+		}
+
+		/**
+		 * @brief Setzt die Taktfrequenz. Die tatsächliche Frequenz liegt wegen der Laufzeit der
+		 * Bitoperationen darunter, oberhalb von etwa 400 kHz wird nicht weiter beschleunigt.
+		 *
+		 * @param clock Taktfrequenz in Hz
+		 */
+		void setClock(const uint32_t clock)
+		{
+			const uint32_t halfPeriod = (clock > 0) ? (500000UL / clock) : 5;
+			m_halfPeriod = (halfPeriod > 0) ? static_cast<uint16_t>(halfPeriod) : 1;
+		}
+
+		void beginTransmission(const uint8_t address)
+		{
+			m_address = address;
+			m_txLength = 0;
+			m_txOverflow = false;
+		}
+
+		size_t write(const uint8_t data)
+		{
+			if (m_txLength >= BUFFER_LENGTH)
+			{
+				m_txOverflow = true;
+				return 0;
+			}
+
+			m_txBuffer[m_txLength++] = data;
+			return 1;
+		}
+
+		/**
+		 * @brief Überträgt die gepufferten Daten
+		 *
+		 * @param stop true Stoppbedingung senden, false Bus für wiederholten Start halten
+		 * @return uint8_t Rückgabewert wie Wire.endTransmission()
+		 */
+		uint8_t endTransmission(const bool stop = true)
+		{
+			if (m_txOverflow)
+			{
+				return DATA_TOO_LONG;
+			}
+
+			uint8_t result = SUCCESS;
+
+			if (!start())
+			{
+				result = m_timedOut ? TIMEOUT : OTHER;
+			}
+			else if (!writeByte(static_cast<uint8_t>(m_address << 1)))
+			{
+				result = m_timedOut ? TIMEOUT : NACK_ON_ADDR;
+			}
+			else
+			{
+				for (uint8_t i = 0; i < m_txLength; i++)
+				{
+					if (!writeByte(m_txBuffer[i]))
+					{
+						result = m_timedOut ? TIMEOUT : NACK_ON_DATA;
+						break;
+					}
+				}
+			}
+
+			if (stop || (result != SUCCESS))
+			{
+				this->stop();
+			}
+			return result;
+		}
+
+		/**
+		 * @brief Liest Daten vom Slave in den Empfangspuffer
+		 *
+		 * @param address Adresse des Slaves
+		 * @param quantity Anzahl der Bytes, höchstens BUFFER_LENGTH
+		 * @return uint8_t Anzahl der empfangenen Bytes
+		 */
+		uint8_t requestFrom(const uint8_t address, const uint8_t quantity)
+		{
+			const uint8_t length = (quantity > BUFFER_LENGTH) ? BUFFER_LENGTH : quantity;
+
+			m_rxLength = 0;
+			m_rxIndex = 0;
+
+			if (length == 0 || !start() || !writeByte(static_cast<uint8_t>((address << 1) | 0x01)))
+			{
+				stop();
+				return 0;
+			}
+
+			for (uint8_t i = 0; i < length; i++)
+			{
+				// letztes Byte mit NACK quittieren
+				m_rxBuffer[i] = readByte(i + 1 < length);
+				if (m_timedOut)
+				{
+					break;
+				}
+				m_rxLength++;
+			}
+
+			stop();
+			return m_rxLength;
+		}
+
+		int available()
+		{
+			return m_rxLength - m_rxIndex;
+		}
+
+		int read()
+		{
+			return (m_rxIndex < m_rxLength) ? m_rxBuffer[m_rxIndex++] : -1;
+		}
+
+		/**
+		 * @brief Gibt die Anzahl der Überschreitungen von STRETCH_TIMEOUT_US zurück
+		 *
+		 * @return uint16_t Anzahl der Zeitüberschreitungen
+		 */
+		uint16_t timeouts() const
+		{
+			return m_timeouts;
+		}
+
+	private: // private Methoden
+		/**
+		 * @brief Zieht die Datenleitung auf Low
+		 */
+		void pullSda()
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			const uint8_t sreg = SREG;
+			cli();
+			*m_sdaMode |= m_sdaMask;
+			SREG = sreg;
+#else
+			pinMode(SdaPin, OUTPUT);
+#endif
+		}
+
+		/**
+		 * @brief Gibt die Datenleitung frei, der Pull-up zieht sie auf High
+		 */
+		void releaseSda()
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			const uint8_t sreg = SREG;
+			cli();
+			*m_sdaMode &= ~m_sdaMask;
+			SREG = sreg;
+#else
+			pinMode(SdaPin, INPUT);
+#endif
+		}
+
+		const bool readSda() const
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			return (*m_sdaIn & m_sdaMask) != 0;
+#else
+			return digitalRead(SdaPin) == HIGH;
+#endif
+		}
+
+		/**
+		 * @brief Zieht die Taktleitung auf Low
+		 */
+		void pullScl()
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			const uint8_t sreg = SREG;
+			cli();
+			*m_sclMode |= m_sclMask;
+			SREG = sreg;
+#else
+			pinMode(SclPin, OUTPUT);
+#endif
+		}
+
+		/**
+		 * @brief Gibt die Taktleitung frei und wartet, solange der Slave sie auf Low hält
+		 * (Clock Stretching)
+		 *
+		 * @return true Taktleitung ist High
+		 * @return false Zeitschranke überschritten
+		 */
+		const bool releaseScl()
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			const uint8_t sreg = SREG;
+			cli();
+			*m_sclMode &= ~m_sclMask;
+			SREG = sreg;
+#else
+			pinMode(SclPin, INPUT);
+#endif
+			if (readScl())
+			{
+				return true;
+			}
+
+			const unsigned long start = micros();
+			while (!readScl())
+			{
+				if ((micros() - start) > STRETCH_TIMEOUT_US)
+				{
+					m_timedOut = true;
+					m_timeouts++;
+					return false;
+				}
+			}
+			return true;
+		}
+
+		const bool readScl() const
+		{
+#if defined(ARDUINO_ARCH_AVR)
+			return (*m_sclIn & m_sclMask) != 0;
+#else
+			return digitalRead(SclPin) == HIGH;
+#endif
+		}
+
+		/**
+		 * @brief Wartet eine halbe Taktperiode
+		 */
+		void wait() const
+		{
+			delayMicroseconds(m_halfPeriod);
+		}
+
+		/**
+		 * @brief Erzeugt eine (wiederholte) Startbedingung
+		 *
+		 * @return true Startbedingung erzeugt
+		 * @return false Bus belegt oder Zeitschranke überschritten
+		 */
+		const bool start()
+		{
+			m_timedOut = false;
+
+			releaseSda();
+			wait();
+			if (!releaseScl())
+			{
+				return false;
+			}
+			wait();
+
+			// ein anderer Teilnehmer hält die Datenleitung
+			if (!readSda())
+			{
+				return false;
+			}
+
+			pullSda();
+			wait();
+			pullScl();
+			return true;
+		}
+
+		/**
+		 * @brief Erzeugt eine Stoppbedingung
+		 */
+		void stop()
+		{
+			pullSda();
+			wait();
+			releaseScl();
+			wait();
+			releaseSda();
+			wait();
+		}
+
+		/**
+		 * @brief Sendet ein Byte, höchstwertiges Bit zuerst
+		 *
+		 * @param data zu sendendes Byte
+		 * @return true ACK erhalten
+		 * @return false NACK erhalten oder Zeitschranke überschritten
+		 */
+		const bool writeByte(uint8_t data)
+		{
+			for (uint8_t bit = 0; bit < 8; bit++)
+			{
+				if (data & 0x80)
+				{
+					releaseSda();
+				}
+				else
+				{
+					pullSda();
+				}
+				data <<= 1;
+
+				wait();
+				if (!releaseScl())
+				{
+					return false;
+				}
+				wait();
+				pullScl();
+			}
+
+			// ACK des Slaves lesen
+			releaseSda();
+			wait();
+			if (!releaseScl())
+			{
+				return false;
+			}
+			const bool ack = !readSda();
+			wait();
+			pullScl();
+			return ack;
+		}
+
+		/**
+		 * @brief Empfängt ein Byte, höchstwertiges Bit zuerst
+		 *
+		 * @param ack true mit ACK quittieren, false mit NACK
+		 * @return uint8_t empfangenes Byte
+		 */
+		uint8_t readByte(const bool ack)
+		{
+			uint8_t data = 0;
+
+			releaseSda();
+			for (uint8_t bit = 0; bit < 8; bit++)
+			{
+				wait();
+				if (!releaseScl())
+				{
+					return data;
+				}
+				data = static_cast<uint8_t>((data << 1) | (readSda() ? 1 : 0));
+				wait();
+				pullScl();
+			}
+
+			if (ack)
+			{
+				pullSda();
+			}
+			wait();
+			if (!releaseScl())
+			{
+				return data;
+			}
+			wait();
+			pullScl();
+			releaseSda();
+			return data;
+		}
+
+	private: // private Member
+#if defined(ARDUINO_ARCH_AVR)
+		volatile uint8_t *m_sdaMode; // Richtungsregister der Datenleitung
+		volatile uint8_t *m_sdaIn; // Eingangsregister der Datenleitung
+		uint8_t m_sdaMask; // Bitmaske der Datenleitung
+		volatile uint8_t *m_sclMode; // Richtungsregister der Taktleitung
+		volatile uint8_t *m_sclIn; // Eingangsregister der Taktleitung
+		uint8_t m_sclMask; // Bitmaske der Taktleitung
+#endif
+		uint16_t m_halfPeriod; // halbe Taktperiode in µs
+		uint8_t m_address; // Adresse der laufenden Übertragung
+		uint8_t m_txBuffer[BUFFER_LENGTH]; // Sendepuffer
+		uint8_t m_txLength; // Anzahl der Bytes im Sendepuffer
+		bool m_txOverflow; // Sendepuffer übergelaufen
+		uint8_t m_rxBuffer[BUFFER_LENGTH]; // Empfangspuffer
+		uint8_t m_rxLength; // Anzahl der Bytes im Empfangspuffer
+		uint8_t m_rxIndex; // Position des nächsten zu lesenden Bytes
+		bool m_timedOut; // Zeitschranke in der laufenden Übertragung überschritten
+		uint16_t m_timeouts; // Anzahl der Zeitüberschreitungen
+};
+
+} // namespace communication
+
+#endif // !SOFT_WIRE_BUS_H
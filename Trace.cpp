@@ -0,0 +1,113 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include "Trace.h"
+
+#include <Arduino.h>
+
+namespace communication
+{
+	namespace
+	{
+		/**
+		 * @brief Schreibt einen Wert mit der angegebenen Anzahl Bytes in Little Endian
+		 */
+		void put(Print &out, const uint32_t value, const uint8_t bytes)
+		{
+			for (uint8_t i = 0; i < bytes; i++)
+			{
+				out.write(static_cast<uint8_t>(value >> (8 * i)));
+			}
+		}
+	}
+
+#if NUNCHUK_TRACE
+	TraceRecord Trace::s_records[CAPACITY]{};
+	uint16_t Trace::s_next{0};
+	uint16_t Trace::s_size{0};
+	uint32_t Trace::s_dropped{0};
+
+	void Trace::record(const uint8_t point, const uint8_t arg, const uint32_t start,
+		const uint32_t duration)
+	{
+		s_records[s_next] = TraceRecord{start, duration, point, arg};
+		s_next = (s_next + 1 < CAPACITY) ? s_next + 1 : 0;
+
+		if (s_size < CAPACITY)
+		{
+			s_size++;
+		}
+		else
+		{
+			s_dropped++;
+		}
+	}
+
+	void Trace::dump(Print &out)
+	{
+		out.write(reinterpret_cast<const uint8_t *>("NTRC"), 4);
+		put(out, VERSION, 1);
+		put(out, RECORD_SIZE, 1);
+		put(out, s_size, 2);
+		put(out, s_dropped, 4);
+
+		// ältester Eintrag zuerst
+		uint16_t index = (s_size < CAPACITY) ? 0 : s_next;
+		for (uint16_t i = 0; i < s_size; i++)
+		{
+			const TraceRecord &record = s_records[index];
+			put(out, record.start, 4);
+			put(out, record.duration, 4);
+			put(out, record.point, 1);
+			put(out, record.arg, 1);
+			index = (index + 1 < CAPACITY) ? index + 1 : 0;
+		}
+	}
+
+	void Trace::clear()
+	{
+		s_next = 0;
+		s_size = 0;
+		s_dropped = 0;
+	}
+
+	const uint16_t Trace::size()
+	{
+		return s_size;
+	}
+
+	const uint32_t Trace::dropped()
+	{
+		return s_dropped;
+	}
+#else
+	void Trace::record(const uint8_t, const uint8_t, const uint32_t, const uint32_t)
+	{
+	}
+
+	void Trace::dump(Print &out)
+	{
+		out.write(reinterpret_cast<const uint8_t *>("NTRC"), 4);
+		put(out, VERSION, 1);
+		put(out, RECORD_SIZE, 1);
+		put(out, 0, 2);
+		put(out, 0, 4);
+	}
+
+	void Trace::clear()
+	{
+	}
+
+	const uint16_t Trace::size()
+	{
+		return 0;
+	}
+
+	const uint32_t Trace::dropped()
+	{
+		return 0;
+	}
+#endif
+} // namespace communication
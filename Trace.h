@@ -0,0 +1,224 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Trace.h
+ *
+ * @brief  Klassendefinitionen zur Aufzeichnung von Zeitspannen der Phasen von begin()
+ *         und read() in einem Ringpuffer fester Größe
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+
+#include "Clock.h"
+
+// Aufzeichnung einschalten (1) bzw. vollständig entfernen (0); muss für alle
+// Übersetzungseinheiten gleich gesetzt werden, z. B. über die Build-Flags
+#ifndef NUNCHUK_TRACE
+#define NUNCHUK_TRACE 0
+#endif
+
+// Anzahl der Einträge des Ringpuffers (je 10 Byte auf AVR)
+#ifndef NUNCHUK_TRACE_RECORDS
+#define NUNCHUK_TRACE_RECORDS 32
+#endif
+
+namespace communication
+{
+
+// Phasen der Aufzeichnung; Namen siehe extras/trace_to_chrome.py
+namespace TracePoint
+{
+	using TracePointConstant = const uint8_t;
+
+	// gesamter Aufruf von read() bzw. begin()
+	constexpr TracePointConstant READ{0};
+	constexpr TracePointConstant BEGIN{1};
+
+	// Pegelwandler ein- bzw. ausschalten, einschließlich Einschwingzeit
+	constexpr TracePointConstant ENABLE{2};
+	constexpr TracePointConstant DISABLE{3};
+
+	// Kanal des Multiplexers wählen
+	constexpr TracePointConstant SELECT{4};
+
+	// Verbindungsaufbau: Warmstart prüfen, Initialisierung, Kalibrierung bzw. Profil,
+	// Messung des Mindestabstands
+	constexpr TracePointConstant PROBE{5};
+	constexpr TracePointConstant INITIALIZE{6};
+	constexpr TracePointConstant CALIBRATE{7};
+	constexpr TracePointConstant MEASURE_GAP{8};
+
+	// Registerzeiger setzen, Warten auf die Wandlung, Lesezugriff (Argument: empfangene
+	// Bytes), Entschlüsseln und Prüfen des Datensatzes
+	constexpr TracePointConstant WRITE_POINTER{9};
+	constexpr TracePointConstant AWAIT_CONVERSION{10};
+	constexpr TracePointConstant REQUEST_FROM{11};
+	constexpr TracePointConstant RECEIVE{12};
+
+	// Verarbeitung: Filter-Policy, Entprellung einschließlich Callbacks der Buttons,
+	// Gestenerkennung, Verteilung an die Abonnenten
+	constexpr TracePointConstant FILTER{13};
+	constexpr TracePointConstant DEBOUNCE{14};
+	constexpr TracePointConstant GESTURES{15};
+	constexpr TracePointConstant DISTRIBUTE{16};
+
+	// Ausgabe mit print()
+	constexpr TracePointConstant PRINT{17};
+
+	// erste frei verwendbare Kennung für eigene Phasen der Anwendung
+	constexpr TracePointConstant USER{64};
+};
+
+/**
+ * @brief Eintrag des Ringpuffers: eine abgeschlossene Zeitspanne
+ */
+struct TraceRecord
+{
+	uint32_t start; // Beginn in µs, siehe Clock::current()
+	uint32_t duration; // Dauer in µs
+	uint8_t point; // Phase, siehe TracePoint
+	uint8_t arg; // phasenabhängiges Argument
+};
+
+/**
+ * @brief Ringpuffer der Aufzeichnung. Bei vollem Puffer wird der älteste Eintrag
+ * überschrieben und gezählt. Aufzeichnen und Ausgeben müssen im selben Kontext erfolgen
+ * (nicht aus einer ISR bzw. einem anderen Task).
+ *
+ * dump() schreibt binär (Little Endian): Kennung "NTRC", Version (1 Byte), Größe eines
+ * Eintrags (1 Byte), Anzahl der Einträge (2 Byte), Anzahl der überschriebenen Einträge
+ * (4 Byte), danach die Einträge vom ältesten zum neuesten mit je start (4 Byte), duration
+ * (4 Byte), point und arg (je 1 Byte). extras/trace_to_chrome.py wandelt die Ausgabe in das
+ * Trace-Format von Chrome/Perfetto.
+ *
+ * Ist NUNCHUK_TRACE 0, belegt der Puffer keinen Speicher und dump() schreibt nur den Kopf.
+ */
+class Trace
+{
+
+public: // public static Member
+	// Anzahl der Einträge
+	static constexpr const uint16_t CAPACITY{NUNCHUK_TRACE_RECORDS};
+
+	// Version des Ausgabeformats
+	static constexpr const uint8_t VERSION{1};
+
+	// Größe eines Eintrags in der Ausgabe in Byte
+	static constexpr const uint8_t RECORD_SIZE{10};
+
+public: // public Methoden
+	/**
+	 * @brief Zeichnet eine abgeschlossene Zeitspanne auf
+	 *
+	 * @param point Phase, siehe TracePoint
+	 * @param arg phasenabhängiges Argument
+	 * @param start Beginn in µs
+	 * @param duration Dauer in µs
+	 */
+	static void record(const uint8_t point, const uint8_t arg, const uint32_t start,
+		const uint32_t duration);
+
+	/**
+	 * @brief Schreibt den Inhalt des Ringpuffers binär, z. B. auf die serielle Schnittstelle.
+	 * Der Puffer bleibt unverändert.
+	 *
+	 * @param out Ziel der Ausgabe
+	 */
+	static void dump(Print &out);
+
+	/**
+	 * @brief Leert den Ringpuffer und setzt den Zähler der überschriebenen Einträge zurück
+	 */
+	static void clear();
+
+	/**
+	 * @brief Gibt die Anzahl der Einträge im Ringpuffer zurück
+	 */
+	static const uint16_t size();
+
+	/**
+	 * @brief Gibt die Anzahl der überschriebenen Einträge zurück
+	 */
+	static const uint32_t dropped();
+
+private: // private Member
+#if NUNCHUK_TRACE
+	static TraceRecord s_records[CAPACITY]; // Ringpuffer
+	static uint16_t s_next; // Position des nächsten Eintrags
+	static uint16_t s_size; // Anzahl der Einträge
+	static uint32_t s_dropped; // Anzahl der überschriebenen Einträge
+#endif
+
+};
+
+/**
+ * @brief Zeitspanne vom Konstruieren bis zum Zerstören des Objekts, z. B. eines Blocks
+ *
+ * @tparam Enabled false: leere Klasse, der Aufruf entfällt vollständig
+ */
+template<
+	bool Enabled
+>
+class TraceSpanT
+{
+	public: // public Methoden
+		/**
+		 * @brief Beginnt die Zeitspanne
+		 *
+		 * @param point Phase, siehe TracePoint
+		 * @param arg phasenabhängiges Argument
+		 */
+		TraceSpanT(const uint8_t point, const uint8_t arg = 0)
+		: m_start{Clock::current()},
+		  m_point{point},
+		  m_arg{arg}
+		{
+
+		}
+
+		/**
+		 * @brief Beendet die Zeitspanne und zeichnet sie auf
+		 */
+		~TraceSpanT()
+		{
+			Trace::record(m_point, m_arg, m_start, Clock::current() - m_start);
+		}
+
+		/**
+		 * @brief Setzt das Argument nachträglich, z. B. auf ein Ergebnis der Phase
+		 */
+		void setArg(const uint8_t arg)
+		{
+			m_arg = arg;
+		}
+
+		TraceSpanT(const TraceSpanT &) = delete;
+		TraceSpanT &operator=(const TraceSpanT &) = delete;
+
+	private: // private Member
+		const uint32_t m_start; // Beginn in µs
+		const uint8_t m_point; // Phase
+		uint8_t m_arg; // Argument
+};
+
+template<>
+class TraceSpanT<false>
+{
+	public: // public Methoden
+		TraceSpanT(const uint8_t, const uint8_t = 0) {}
+
+		void setArg(const uint8_t) {}
+};
+
+// Zeitspanne entsprechend NUNCHUK_TRACE
+using TraceSpan = TraceSpanT<NUNCHUK_TRACE != 0>;
+
+} // namespace communication
+
+#endif // !TRACE_H
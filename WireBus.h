@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#ifndef WIRE_BUS_H
+#define WIRE_BUS_H
+
+#include <Arduino.h>
+#include <Wire.h>
+
+namespace communication
+{
+
+/**
+ * @brief Bus-Policy für die Hardware-I2C-Schnittstelle. Leitet alle Aufrufe an das globale
+ * Wire-Objekt weiter und belegt selbst keinen Speicher.
+ * Andere Bus-Implementierungen müssen dieselbe Schnittstelle bereitstellen.
+ */
+class WireBus
+{
+	public: // public Methoden
+		void begin()
+		{
+			Wire.begin();
+		}
+
+		void end()
+		{
+			Wire.end();
+		}
+
+		void setClock(const uint32_t clock)
+		{
+			Wire.setClock(clock);
+		}
+
+		void beginTransmission(const uint8_t address)
+		{
+			Wire.beginTransmission(address);
+		}
+
+		size_t write(const uint8_t data)
+		{
+			return Wire.write(data);
+		}
+
+		uint8_t endTransmission(const bool stop = true)
+		{
+			return Wire.endTransmission(stop);
+		}
+
+		uint8_t requestFrom(const uint8_t address, const uint8_t quantity)
+		{
+			return Wire.requestFrom(address, quantity);
+		}
+
+		int available()
+		{
+			return Wire.available();
+		}
+
+		int read()
+		{
+			return Wire.read();
+		}
+};
+
+} // namespace communication
+
+#endif // !WIRE_BUS_H
@@ -1,30 +1,44 @@
-#include <Wire.h>
-#include <Nunchuk.h>
-
-using namespace communication;
-constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
-Nunchuk dev{PIN_LVLSHFT_NUNCHUK, 100, 50, ClockMode::I2C_CLOCK_FAST_400_kHz};
-
-
-void setup()
-{
-  Serial.begin(115200);
-  delay(3000);
-  Serial.println("Serieller Monitor initialisiert");
-
-  // Nunchuk initialisieren
-  dev.begin();
-}
-
-void loop()
-{
-  // Messwerte auslesen
-  if(dev.read() != State::NO_DATA_AVAILABLE)
-  {
-    Serial.println();
-    // Messwerte auslesen
-    dev.print();
-  }
-
-  delayMicroseconds(1000);
+#include <Wire.h>
+#include <Nunchuk.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+
+// Standardkonfiguration, zusätzlich mit Messung der Zeit bis zum ersten Datensatz
+using TimedNunchuk = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer, StartupTiming>;
+TimedNunchuk dev{PIN_LVLSHFT_NUNCHUK, 100, 50, ClockMode::I2C_CLOCK_FAST_400_kHz};
+bool startupReported{false};
+
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+  // Nunchuk initialisieren
+  dev.begin();
+}
+
+void loop()
+{
+  // Messwerte auslesen
+  if(dev.read() == State::CONNECTED)
+  {
+    // einmalig die Zeit bis zum ersten Datensatz ausgeben
+    if (!startupReported && dev.timeToFirstSample() != 0)
+    {
+      startupReported = true;
+      Serial.print(dev.isWarmStart() ? "Warmstart" : "Kaltstart");
+      Serial.print(", erster Datensatz nach ");
+      Serial.print(dev.timeToFirstSample(), DEC);
+      Serial.println(" us");
+    }
+
+    Serial.println();
+    // Messwerte auslesen
+    dev.print();
+  }
+
+  delayMicroseconds(1000);
 }
\ No newline at end of file
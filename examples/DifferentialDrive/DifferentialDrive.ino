@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <Failsafe.h>
+#include <Nunchuk.h>
+#include <DifferentialDrive.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+
+// PWM- und Richtungspins der Motortreiber
+constexpr const uint8_t PIN_PWM_LEFT{5};
+constexpr const uint8_t PIN_DIR_LEFT{4};
+constexpr const uint8_t PIN_PWM_RIGHT{6};
+constexpr const uint8_t PIN_DIR_RIGHT{7};
+
+// Standardkonfiguration mit Failsafe
+using SafeNunchuk = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer, FailsafeSupport>;
+SafeNunchuk dev{PIN_LVLSHFT_NUNCHUK, 100UL, 30UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+DifferentialDrive drive{255};
+
+// spätestens 100 ms nach dem letzten frischen Datensatz stehen die Motoren
+Failsafe failsafe{100, 20};
+
+void output(const MotorCommand &command)
+{
+  digitalWrite(PIN_DIR_LEFT, command.leftForward() ? HIGH : LOW);
+  analogWrite(PIN_PWM_LEFT, command.leftDuty());
+  digitalWrite(PIN_DIR_RIGHT, command.rightForward() ? HIGH : LOW);
+  analogWrite(PIN_PWM_RIGHT, command.rightDuty());
+}
+
+// ohne Rampe anhalten, sobald der Failsafe auslöst
+void onFailsafe(void *, const FailsafeEvent &event)
+{
+  if (event.type == FailsafeEvent::Type::ENGAGED)
+  {
+    drive.reset();
+    output(drive.command());
+  }
+}
+
+void setup()
+{
+  pinMode(PIN_DIR_LEFT, OUTPUT);
+  pinMode(PIN_DIR_RIGHT, OUTPUT);
+
+  // feinfühlige Steuerung um die Mitte, halbe Lenkverstärkung, 0 -> 255 in ca. 0,5 s
+  drive.setDeadzone(8);
+  drive.setExpo(128);
+  drive.setTurnGain(DifferentialDrive::UNITY_GAIN / 2);
+  drive.setSlewRate(16);
+
+  failsafe.onFailsafe(FailsafeDelegate{&onFailsafe});
+  dev.setFailsafe(failsafe);
+
+  dev.begin();
+}
+
+void loop()
+{
+  if (dev.read() != State::CONNECTED)
+  {
+    return;
+  }
+
+  // nur bei neuen Daten mischen, damit die Rampe der Zykluszeit folgt
+  output(drive.update(dev.decodeJoystickX(), dev.decodeJoystickY()));
+}
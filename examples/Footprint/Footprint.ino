@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <AutoCenter.h>
+#include <Failsafe.h>
+#include <Gesture.h>
+#include <I2CMultiplexer.h>
+#include <Nunchuk.h>
+#include <Profile.h>
+#include <Publisher.h>
+
+using namespace communication;
+
+// Zu vermessende Konfiguration auswählen; der Flashbedarf ergibt sich aus der Ausgabe des
+// Compilers, der RAM-Bedarf eines Objekts wird zusätzlich über den seriellen Monitor ausgegeben.
+// In Klammern sizeof auf dem Host (x86-64, g++ 12.2), Werte für AVR im README nachtragen.
+//  0: Nunchuk (Standardkonfiguration, 312 Byte)
+//  1: ohne Pegelwandler, Entprellung, Filter, Zykluszeit und Erweiterungen (80 Byte)
+//  2: fester Pegelwandler, Entprellung, gleitender Mittelwert über 4 Werte (376 Byte)
+//  3: Nunchuk mit allen Erweiterungen (400 Byte)
+#define CONFIGURATION 0
+
+#if CONFIGURATION == 0
+using Device = Nunchuk;
+Device dev{uint8_t{11}, 100UL, 30UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+#elif CONFIGURATION == 1
+using Device = NunchukT<WireBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>;
+Device dev{0UL, 0UL};
+#elif CONFIGURATION == 2
+using Device = NunchukT<WireBus, LevelShifter, ButtonDebounce, MovingAverageFilter<4>, CycleTimer>;
+Device dev{uint8_t{11}, 100UL, 30UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+#else
+using Device = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer,
+  MultiplexerSupport, ProfileSupport, AutoCenterSupport, PublisherSupport, GestureSupport,
+  FailsafeSupport, StartupTiming>;
+Device dev{uint8_t{11}, 100UL, 30UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+#endif
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+
+  Serial.print("Konfiguration ");
+  Serial.print(CONFIGURATION, DEC);
+  Serial.print(": ");
+  Serial.print(static_cast<unsigned long>(sizeof(Device)), DEC);
+  Serial.println(" Byte RAM je Objekt");
+
+  dev.begin();
+}
+
+void loop()
+{
+  if (dev.read() == State::CONNECTED)
+  {
+    dev.print();
+  }
+}
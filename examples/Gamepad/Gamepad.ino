@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <Nunchuk.h>
+#include <Publisher.h>
+#include <Gamepad.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+// Standardkonfiguration mit Abonnenten
+using PublishingNunchuk = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer, PublisherSupport>;
+PublishingNunchuk dev{PIN_LVLSHFT_NUNCHUK, 50, 10, ClockMode::I2C_CLOCK_FAST_400_kHz};
+
+Publisher publisher;
+
+// unveränderter Report spätestens alle 500 ms
+Gamepad gamepad{500000};
+
+#if defined(USBCON)
+// Arduino Micro/Leonardo: global, damit der Deskriptor vor der Enumeration angemeldet ist
+UsbGamepadSink usb;
+#else
+// ohne native USB-Schnittstelle (oder auf dem Host): Reports seriell ausgeben
+bool printReport(void *, const GamepadReport &report)
+{
+  Serial.print("Buttons ");
+  Serial.print(report.buttons, DEC);
+  Serial.print(", X ");
+  Serial.print(report.x, DEC);
+  Serial.print(", Y ");
+  Serial.print(report.y, DEC);
+  Serial.print(", Rx ");
+  Serial.print(report.rx, DEC);
+  Serial.print(", Ry ");
+  Serial.print(report.ry, DEC);
+  Serial.print(", Rz ");
+  Serial.println(report.rz, DEC);
+  return true;
+}
+#endif
+
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+#if defined(USBCON)
+  gamepad.setSink(usb.sink());
+#else
+  gamepad.setSink(ReportSink{&printReport});
+#endif
+
+  // Rauschen des Beschleunigungssensors unterhalb von 4 Reporteinheiten ignorieren
+  gamepad.setThresholds(1, 4);
+  publisher.subscribe(1, gamepad.fields(), ReadingDelegate::fromMethod<Gamepad, &Gamepad::update>(gamepad));
+  dev.setPublisher(publisher);
+
+  // Nunchuk initialisieren
+  dev.begin();
+}
+
+void loop()
+{
+  // neue Datensätze gelangen über den Publisher zum Gamepad
+  dev.read();
+
+  // ohne Verbindung Mittelstellung melden statt der letzten Werte
+  if (!dev.isConnected())
+  {
+    gamepad.neutral();
+  }
+
+  // Keep-Alive und Wiederholung nicht angenommener Reports
+  gamepad.poll();
+}
@@ -0,0 +1,56 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <Nunchuk.h>
+#include <PowerSaver.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+Nunchuk dev{PIN_LVLSHFT_NUNCHUK, 100, 50, ClockMode::I2C_CLOCK_FAST_400_kHz};
+
+// zwischen den Abfragen im Idle-Modus schlafen, bei längeren Pausen (z. B. ohne Verbindung)
+// im Power-Down
+PowerSaver saver{SleepMode::POWER_DOWN};
+
+#if defined(__AVR__) && !NUNCHUK_POWERSAVER_WDT_ISR
+// der Watchdog-Interrupt weckt aus dem Power-Down; ohne Vektor würde er den Mikrocontroller
+// zurücksetzen. Alternativ global NUNCHUK_POWERSAVER_WDT_ISR=1 setzen (z. B. build_flags =
+// -DNUNCHUK_POWERSAVER_WDT_ISR=1 bei PlatformIO), dann stellt die Bibliothek ihn bereit.
+ISR(WDT_vect)
+{
+}
+#endif
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+  // Nunchuk initialisieren
+  dev.begin();
+}
+
+void loop()
+{
+  // Messwerte auslesen
+  if (dev.read() == State::CONNECTED)
+  {
+    Serial.print("X = ");
+    Serial.print(dev.decodeJoystickX(), DEC);
+    Serial.print(", Y = ");
+    Serial.print(dev.decodeJoystickY(), DEC);
+    Serial.print(", wach ");
+    Serial.print(saver.dutyCycle() / 10.0, 1);
+    Serial.println(" %");
+
+    // Ausgabe abschließen, bevor die serielle Schnittstelle im Power-Down stehen bleibt
+    Serial.flush();
+  }
+
+  // bis zur nächsten Abfrage, dem Ablauf der Entprellung oder dem nächsten Verbindungsaufbau
+  saver.sleepUntilNextEvent(dev);
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Nunchuk.h>
+
+using namespace communication;
+
+// Anzahl der Aufrufe je Messung
+constexpr const uint16_t RUNS{1000};
+
+// Testsignal mit einem Ausreißer alle 97 Werte
+const int16_t sample(const uint16_t i)
+{
+  return ((i % 97) == 50) ? 1023 : static_cast<int16_t>(500 + (i % 5));
+}
+
+template<class Filter>
+void measure(const char *name)
+{
+  Filter filter;
+  int16_t maximum = 0;
+
+  const unsigned long start = micros();
+  for (uint16_t i = 0; i < RUNS; i++)
+  {
+    const int16_t value = sample(i);
+    filter.update(value, value, value);
+    if (filter.accelerationX() > maximum)
+    {
+      maximum = filter.accelerationX();
+    }
+  }
+  const unsigned long elapsed = micros() - start;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(static_cast<double>(elapsed) / RUNS, 2);
+  Serial.print(" us je Datensatz, Maximum ");
+  Serial.println(maximum, DEC);
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+  // Laufzeit je Datensatz (drei Achsen) und größter ausgegebener Wert
+  measure<MovingAverageFilter<8>>("Mittelwert 8");
+  measure<MedianFilter<5>>("Median 5");
+  measure<MedianFilter<9>>("Median 9");
+  measure<HampelFilter<5>>("Hampel 5");
+  measure<HampelFilter<9>>("Hampel 9");
+}
+
+void loop()
+{
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <I2CMultiplexer.h>
+#include <Nunchuk.h>
+#include <NunchukGroup.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+
+// Standardkonfiguration mit Multiplexer
+using MuxNunchuk = NunchukT<WireBus, OptionalLevelShifter, ButtonDebounce, NoFilter, CycleTimer, MultiplexerSupport>;
+
+// zwei Nunchuks an den Kanälen 0 und 1 eines TCA9548A
+I2CMultiplexer mux{I2CMultiplexer::ADDR_DEFAULT};
+MuxNunchuk left{PIN_LVLSHFT_NUNCHUK, 100, 20, ClockMode::I2C_CLOCK_FAST_400_kHz};
+MuxNunchuk right{PIN_LVLSHFT_NUNCHUK, 100, 20, ClockMode::I2C_CLOCK_FAST_400_kHz};
+NunchukGroup<2, MuxNunchuk> group;
+
+unsigned long lastReport{0};
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+  left.setMultiplexer(mux, 0);
+  right.setMultiplexer(mux, 1);
+
+  group.add(left);
+  group.add(right);
+
+  // Nunchuks initialisieren
+  group.begin();
+}
+
+void loop()
+{
+  // Geräte reihum auslesen
+  MuxNunchuk *dev = group.read();
+  if (dev)
+  {
+    Serial.print(dev == &left ? "links:  X = " : "rechts: X = ");
+    Serial.print(dev->decodeJoystickX(), DEC);
+    Serial.print("\tY = ");
+    Serial.println(dev->decodeJoystickY(), DEC);
+  }
+
+  // Gesamtabtastrate und Kanalwechsel ausgeben
+  if (millis() - lastReport >= 5000)
+  {
+    lastReport = millis();
+    Serial.print("Datensätze/s: ");
+    Serial.print(group.samplesPerSecond(), DEC);
+    Serial.print("\tgeändert/s: ");
+    Serial.print(group.changesPerSecond(), DEC);
+    Serial.print("\tKanalwechsel: ");
+    Serial.println(mux.switches(), DEC);
+  }
+}
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <Nunchuk.h>
+#include <SoftWireBus.h>
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+
+// zweiter Nunchuk an Software-I2C, SDA an Pin 4, SCL an Pin 5 (Pull-ups erforderlich)
+using SoftNunchuk = NunchukT<SoftWireBus<4, 5>, OptionalLevelShifter, ButtonDebounce, NoFilter>;
+
+// Anzahl der Transaktionen je Messung
+constexpr const uint16_t TRANSACTIONS{200};
+
+Nunchuk hardware{PIN_LVLSHFT_NUNCHUK, 100UL, 20UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+SoftNunchuk software{OptionalLevelShifter::NO_PIN, 100UL, 20UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+
+/**
+ * @brief Misst die Dauer einer Transaktion (6 Byte lesen und Registerzeiger setzen).
+ * Beide Wege warten blockierend auf das Ende der Übertragung, die Dauer entspricht daher
+ * der belegten CPU-Zeit.
+ */
+template<class Bus>
+void measure(const char *name, Bus &bus)
+{
+  const unsigned long start = micros();
+  uint16_t received = 0;
+
+  for (uint16_t i = 0; i < TRANSACTIONS; i++)
+  {
+    received += bus.requestFrom(Control::ADDR_NUNCHUK, Control::LEN_RAW_DATA);
+    while (bus.available())
+    {
+      bus.read();
+    }
+
+    bus.beginTransmission(Control::ADDR_NUNCHUK);
+    bus.write(Control::REG_RAW_DATA);
+    bus.endTransmission(true);
+  }
+
+  const unsigned long elapsed = micros() - start;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(elapsed / TRANSACTIONS, DEC);
+  Serial.print(" µs/Transaktion, ");
+  Serial.print((received * 1000000UL) / elapsed, DEC);
+  Serial.println(" Byte/s");
+}
+
+void setup()
+{
+  Serial.begin(115200);
+  delay(3000);
+  Serial.println("Serieller Monitor initialisiert");
+
+  hardware.begin();
+  software.begin();
+
+  measure("Hardware-I2C", hardware.bus());
+  measure("Software-I2C", software.bus());
+}
+
+void loop()
+{
+  if (hardware.read() == State::CONNECTED)
+  {
+    Serial.print("Hardware: X = ");
+    Serial.println(hardware.decodeJoystickX(), DEC);
+  }
+
+  if (software.read() == State::CONNECTED)
+  {
+    Serial.print("Software: X = ");
+    Serial.println(software.decodeJoystickX(), DEC);
+  }
+}
@@ -0,0 +1,52 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Wire.h>
+#include <Nunchuk.h>
+
+// Aufzeichnung nur mit global gesetztem NUNCHUK_TRACE=1 (z. B. build_flags = -DNUNCHUK_TRACE=1
+// bei PlatformIO), ein #define im Sketch erreicht die Bibliothek nicht
+
+using namespace communication;
+constexpr const uint8_t PIN_LVLSHFT_NUNCHUK{11};
+Nunchuk dev{PIN_LVLSHFT_NUNCHUK, 100, 50, ClockMode::I2C_CLOCK_FAST_400_kHz};
+
+// Ringpuffer nach jeweils so vielen Aufrufen von read() ausgeben; ein Durchlauf belegt etwa
+// 12 Einträge, bei 32 Einträgen gehen so keine verloren
+constexpr const uint16_t DUMP_INTERVAL{2};
+uint16_t cycles{0};
+
+
+void setup()
+{
+  // binäre Ausgabe, Aufzeichnen z. B. mit cat /dev/ttyACM0 > trace.bin
+  Serial.begin(115200);
+  delay(3000);
+
+  // Nunchuk initialisieren, die Phasen von begin() landen ebenfalls im Ringpuffer
+  dev.begin();
+}
+
+void loop()
+{
+  dev.read();
+
+  // eigene Phase der Anwendung, erscheint im Trace als user0
+  {
+    TraceSpan span{TracePoint::USER};
+    dev.decodeJoystickX();
+    dev.decodeJoystickY();
+  }
+
+  if (++cycles == DUMP_INTERVAL)
+  {
+    cycles = 0;
+    // Ausgabe außerhalb der aufgezeichneten Phasen, sie verfälscht keine Zeitspanne; doppelt
+    // ausgegebene Einträge verwirft extras/trace_to_chrome.py
+    Trace::dump(Serial);
+  }
+
+  delayMicroseconds(1000);
+}
@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <stdio.h>
+
+namespace
+{
+	// virtuelle Zeit in µs
+	unsigned long s_micros = 0;
+
+	// Ausgabe erst nach Serial.begin()
+	bool s_serial = false;
+
+	size_t printNumber(const unsigned long value, const bool negative, const int base)
+	{
+		if (!s_serial)
+		{
+			return 0;
+		}
+		if (base == HEX)
+		{
+			return fprintf(stderr, "%s%lX", negative ? "-" : "", value);
+		}
+		return fprintf(stderr, "%s%lu", negative ? "-" : "", value);
+	}
+
+	size_t printSigned(const long value, const int base)
+	{
+		return (value < 0) ? printNumber(0UL - static_cast<unsigned long>(value), true, base)
+			: printNumber(static_cast<unsigned long>(value), false, base);
+	}
+}
+
+unsigned long millis()
+{
+	return s_micros / 1000;
+}
+
+unsigned long micros()
+{
+	return s_micros;
+}
+
+void delay(unsigned long ms)
+{
+	s_micros += ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us)
+{
+	s_micros += us;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return HIGH; }
+
+void noInterrupts() {}
+void interrupts() {}
+
+size_t Print::write(uint8_t value) { return s_serial ? (fputc(value, stderr), 1) : 0; }
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+	size_t written = 0;
+	for (size_t i = 0; i < size; i++)
+	{
+		written += write(buffer[i]);
+	}
+	return written;
+}
+
+size_t Print::print(const char *text) { return s_serial ? (fputs(text, stderr), strlen(text)) : 0; }
+size_t Print::print(char value) { return s_serial ? (fputc(value, stderr), 1) : 0; }
+size_t Print::print(int value, int base) { return printSigned(value, base); }
+size_t Print::print(unsigned int value, int base) { return printNumber(value, false, base); }
+size_t Print::print(long value, int base) { return printSigned(value, base); }
+size_t Print::print(unsigned long value, int base) { return printNumber(value, false, base); }
+size_t Print::print(double value, int digits) { return s_serial ? fprintf(stderr, "%.*f", digits, value) : 0; }
+
+size_t Print::println() { return print('\n'); }
+size_t Print::println(const char *text) { return print(text) + println(); }
+size_t Print::println(char value) { return print(value) + println(); }
+size_t Print::println(int value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned int value, int base) { return print(value, base) + println(); }
+size_t Print::println(long value, int base) { return print(value, base) + println(); }
+size_t Print::println(unsigned long value, int base) { return print(value, base) + println(); }
+size_t Print::println(double value, int digits) { return print(value, digits) + println(); }
+
+void HardwareSerial::begin(unsigned long)
+{
+	s_serial = true;
+}
+
+HardwareSerial::operator bool() const
+{
+	return s_serial;
+}
+
+HardwareSerial Serial;
+TwoWire Wire;
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Arduino.h
+ *
+ * @brief  Minimaler Ersatz des Arduino-Kerns, um die Bibliothek zusammen mit SimulatedBus auf
+ *         dem Host zu übersetzen (z. B. extras/soak). Die Zeit ist virtuell: delay() und
+ *         delayMicroseconds() stellen die Uhr vor, millis() und micros() lesen sie nur.
+ *         Serial gibt erst nach Serial.begin() auf stderr aus.
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <string>
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define DEC 10
+#define HEX 16
+
+#define PROGMEM
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t *>(address))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+
+void noInterrupts();
+void interrupts();
+
+class String
+{
+	public:
+		String(const char *text = "") : m_text{text} {}
+		String(const int value) : m_text{std::to_string(value)} {}
+		String(const unsigned long value) : m_text{std::to_string(value)} {}
+
+		String &operator+=(const String &other)
+		{
+			m_text += other.m_text;
+			return *this;
+		}
+
+		const char *c_str() const
+		{
+			return m_text.c_str();
+		}
+
+	private:
+		std::string m_text;
+};
+
+class Print
+{
+	public:
+		virtual size_t write(uint8_t value);
+		size_t write(const uint8_t *buffer, size_t size);
+
+		size_t print(const char *text);
+		size_t print(char value);
+		size_t print(int value, int base = DEC);
+		size_t print(unsigned int value, int base = DEC);
+		size_t print(long value, int base = DEC);
+		size_t print(unsigned long value, int base = DEC);
+		size_t print(double value, int digits = 2);
+
+		size_t println();
+		size_t println(const char *text);
+		size_t println(char value);
+		size_t println(int value, int base = DEC);
+		size_t println(unsigned int value, int base = DEC);
+		size_t println(long value, int base = DEC);
+		size_t println(unsigned long value, int base = DEC);
+		size_t println(double value, int digits = 2);
+};
+
+class HardwareSerial : public Print
+{
+	public:
+		void begin(unsigned long baud);
+		explicit operator bool() const;
+		void flush() {}
+};
+
+extern HardwareSerial Serial;
+
+#endif // !HOST_ARDUINO_H
@@ -0,0 +1,35 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Wire.h
+ *
+ * @brief  Ersatz der Wire-Bibliothek für Host-Builds: ein Bus ohne angeschlossene Geräte.
+ *         Für simulierte Geräte SimulatedBus statt WireBus verwenden.
+ */
+
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <Arduino.h>
+
+class TwoWire
+{
+	public:
+		void begin() {}
+		void end() {}
+		void setClock(uint32_t clock) { (void)clock; }
+		void beginTransmission(uint8_t address) { (void)address; }
+		size_t write(uint8_t data) { (void)data; return 1; }
+		// kein Slave bestätigt die Adresse
+		uint8_t endTransmission(bool stop = true) { (void)stop; return 2; }
+		uint8_t requestFrom(uint8_t address, uint8_t quantity) { (void)address; (void)quantity; return 0; }
+		int available() { return 0; }
+		int read() { return -1; }
+};
+
+extern TwoWire Wire;
+
+#endif // !HOST_WIRE_H
@@ -0,0 +1,277 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Soak.cpp
+ *
+ * @brief  Dauertest des Treibers gegen einen SimulatedNunchuk mit Fehlerinjektion auf dem Host.
+ *         Je Szenario werden die angegebene Anzahl Zyklen ausgeführt und Durchsatz,
+ *         Erholungszeit nach Verbindungsverlust sowie Verstöße gegen die Zustandsmaschine
+ *         ausgegeben. Bei Verstößen endet das Programm mit Rückgabewert 1.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/soak/Soak.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o soak
+ *         ./soak [Zyklen je Szenario] [Startwert]
+ */
+
+#include <Arduino.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, ButtonDebounce, NoFilter, NoCycleTimer>;
+
+// Periode der Anwendungsschleife in µs (virtuelle Zeit)
+constexpr const unsigned long CYCLE_US{1000};
+
+// fehlerfreie Zyklen am Ende jedes Szenarios, in denen sich der Treiber erholen muss
+constexpr const uint32_t SETTLE_CYCLES{1000};
+
+// voreingestellte Anzahl der Zyklen je Szenario
+constexpr const uint32_t DEFAULT_CYCLES{1000000};
+
+/**
+ * @brief Szenario: Gerätetyp und Fehlerwahrscheinlichkeiten in Millionsteln
+ */
+struct Scenario
+{
+  const char *name;
+  bool encryptedOnly;
+  uint32_t rates[SimulatedNunchuk::FAULTS];
+};
+
+// Reihenfolge der Wahrscheinlichkeiten wie SimulatedFault: NACK_ON_ADDR, NACK_ON_DATA,
+// SHORT_READ, STUCK_BUS, CORRUPT_FRAME, LATENCY_SPIKE, RESET
+const Scenario SCENARIOS[]{
+  {"fehlerfrei",              false, {0,    0,    0,    0,   0,    0,    0}},
+  {"NACK Adresse",            false, {2000, 0,    0,    0,   0,    0,    0}},
+  {"NACK Daten",              false, {0,    2000, 0,    0,   0,    0,    0}},
+  {"kurze Lesezugriffe",      false, {0,    0,    2000, 0,   0,    0,    0}},
+  {"blockierter Bus",         false, {0,    0,    0,    100, 0,    0,    0}},
+  {"verfaelschte Datensaetze", false, {0,    0,    0,    0,   2000, 0,    0}},
+  {"Latenzspitzen",           false, {0,    0,    0,    0,   0,    5000, 0}},
+  {"Ruecksetzen",             false, {0,    0,    0,    0,   0,    0,    500}},
+  {"alle Fehler",             false, {500,  500,  500,  20,  500,  1000, 100}},
+  {"alle Fehler, verschl.",   true,  {500,  500,  500,  20,  500,  1000, 100}},
+};
+
+/**
+ * @brief Arten der Verstöße gegen die Zustandsmaschine
+ */
+enum Violation : uint8_t
+{
+  // CONNECTED zurückgegeben, aber nicht der zuletzt gelieferte Datensatz veröffentlicht
+  WRONG_FRAME = 0,
+
+  // Rückgabewert außerhalb der für read() vorgesehenen Zustände
+  UNEXPECTED_STATE,
+
+  // Rückgabewert passt nicht zu isConnected()
+  STATE_MISMATCH,
+
+  // keine Erholung in den fehlerfreien Zyklen am Ende des Szenarios
+  NO_RECOVERY,
+
+  VIOLATIONS
+};
+
+const char *const VIOLATION_NAMES[VIOLATIONS]{
+  "falscher Datensatz", "unerwarteter Zustand", "Zustand widerspruechlich", "keine Erholung"
+};
+
+/**
+ * @brief Ergebnisse eines Szenarios
+ */
+struct Result
+{
+  uint32_t connected;
+  uint32_t unchanged;
+  uint32_t rejected;
+  uint32_t disconnects;
+  uint32_t recoveries;
+  unsigned long recoverySum;
+  unsigned long recoveryMax;
+  uint32_t violations[VIOLATIONS];
+  double seconds;
+  unsigned long virtualTime;
+};
+
+/**
+ * @brief Gibt die Eingänge eines Zyklus vor. Der Joystick ändert sich nur jeden vierten
+ * Zyklus, sodass auch unveränderte Datensätze auftreten.
+ */
+void stimulate(SimulatedNunchuk &device, const uint32_t cycle)
+{
+  const uint8_t step = static_cast<uint8_t>(cycle / 4);
+
+  device.setInput(static_cast<uint8_t>(0x20 + (step % 0xC0)), static_cast<uint8_t>(0xE0 - (step % 0xC0)),
+    static_cast<uint16_t>(512 + (step % 64)), 512, static_cast<uint16_t>(700 - (step % 32)),
+    ((cycle / 300) % 2) == 0, ((cycle / 500) % 2) == 0);
+}
+
+/**
+ * @brief Führt einen Zyklus aus, prüft das Ergebnis und wartet bis zum Ende der Periode
+ *
+ * @return true Datensatz veröffentlicht
+ */
+bool cycle(SimNunchuk &dev, SimulatedNunchuk &device, Result &result, const uint32_t index,
+  bool &down, unsigned long &downSince)
+{
+  const unsigned long start = micros();
+
+  stimulate(device, index);
+  const State state = dev.read();
+
+  switch (state)
+  {
+  case State::CONNECTED:
+    (dev.isDuplicate() ? result.unchanged : result.connected)++;
+    if (!(dev.snapshot() == device.deliveredFrame()))
+    {
+      result.violations[WRONG_FRAME]++;
+    }
+    if (down)
+    {
+      const unsigned long recovery = micros() - downSince;
+      result.recoveries++;
+      result.recoverySum += recovery;
+      result.recoveryMax = (recovery > result.recoveryMax) ? recovery : result.recoveryMax;
+      down = false;
+    }
+    break;
+
+  case State::NO_DATA_AVAILABLE:
+    break;
+
+  case State::BAD_VALUE:
+    result.rejected++;
+    break;
+
+  case State::NOT_CONNECTED:
+    if (!down)
+    {
+      result.disconnects++;
+      down = true;
+      downSince = start;
+    }
+    break;
+
+  default:
+    result.violations[UNEXPECTED_STATE]++;
+    break;
+  }
+
+  if ((state == State::NOT_CONNECTED) == dev.isConnected())
+  {
+    result.violations[STATE_MISMATCH]++;
+  }
+
+  const unsigned long elapsed = micros() - start;
+  if (elapsed < CYCLE_US)
+  {
+    delayMicroseconds(static_cast<unsigned int>(CYCLE_US - elapsed));
+  }
+
+  return (state == State::CONNECTED) && !dev.isDuplicate();
+}
+
+/**
+ * @brief Führt ein Szenario aus: Zyklen mit Fehlerinjektion, danach fehlerfreie Zyklen, in
+ * denen mindestens ein Datensatz veröffentlicht werden muss
+ */
+Result run(const Scenario &scenario, const uint32_t cycles, const uint32_t seed)
+{
+  Result result{};
+  SimulatedNunchuk device{scenario.encryptedOnly};
+  SimNunchuk dev{100UL, 0UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+  bool down = false;
+  unsigned long downSince = 0;
+
+  device.seed(seed);
+  dev.bus().attach(device);
+  dev.begin();
+
+  for (uint8_t i = 0; i < SimulatedNunchuk::FAULTS; i++)
+  {
+    device.setFaultRate(static_cast<SimulatedFault>(i), scenario.rates[i]);
+  }
+
+  const unsigned long virtualStart = micros();
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < cycles; i++)
+  {
+    cycle(dev, device, result, i, down, downSince);
+  }
+
+  result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  result.virtualTime = micros() - virtualStart;
+
+  device.clearFaults();
+  bool recovered = false;
+  for (uint32_t i = 0; i < SETTLE_CYCLES; i++)
+  {
+    recovered = cycle(dev, device, result, cycles + i, down, downSince) || recovered;
+  }
+
+  if (!recovered || !dev.isConnected())
+  {
+    result.violations[NO_RECOVERY]++;
+  }
+
+  printf("%-26s %9.0f %8u %8u %8u %6u %9.2f %9.2f",
+    scenario.name, cycles / result.seconds, result.connected, result.unchanged, result.rejected,
+    result.disconnects,
+    result.recoveries ? result.recoverySum / 1000.0 / result.recoveries : 0.0,
+    result.recoveryMax / 1000.0);
+
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < VIOLATIONS; i++)
+  {
+    total += result.violations[i];
+  }
+  printf(" %6u\n", total);
+
+  for (uint8_t i = 0; i < VIOLATIONS; i++)
+  {
+    if (result.violations[i] > 0)
+    {
+      printf("    %s: %u\n", VIOLATION_NAMES[i], result.violations[i]);
+    }
+  }
+
+  return result;
+}
+
+int main(int argc, char **argv)
+{
+  const uint32_t cycles = (argc > 1) ? strtoul(argv[1], nullptr, 10) : DEFAULT_CYCLES;
+  const uint32_t seed = (argc > 2) ? strtoul(argv[2], nullptr, 10) : 1;
+  bool failed = false;
+
+  printf("%u Zyklen je Szenario, Periode %lu us, Startwert %u\n\n", cycles, CYCLE_US, seed);
+  printf("%-26s %9s %8s %8s %8s %6s %9s %9s %6s\n", "Szenario", "Zyklen/s", "neu", "gleich",
+    "ungueltig", "Abbr.", "Erh. ms", "max ms", "Fehler");
+
+  for (uint8_t i = 0; i < sizeof(SCENARIOS) / sizeof(SCENARIOS[0]); i++)
+  {
+    const Result result = run(SCENARIOS[i], cycles, seed + i);
+
+    for (uint8_t v = 0; v < VIOLATIONS; v++)
+    {
+      failed = failed || (result.violations[v] > 0);
+    }
+  }
+
+  return failed ? 1 : 0;
+}
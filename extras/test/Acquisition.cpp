@@ -0,0 +1,173 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Acquisition.cpp
+ *
+ * @brief  Host-Test der Erfassung im Hintergrund: ein Erzeuger- und ein Verbraucher-Thread
+ *         tauschen Millionen Elemente über StaticEventQueue aus, ohne Verlust und in strenger
+ *         Reihenfolge. Acquisition liefert über SimulatedBus lückenlos nummerierte Datensätze
+ *         im Takt der Periode, schrittweise aus dem Hauptprogramm und im eigenen Thread.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Acquisition.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o acquisition -pthread && ./acquisition
+ */
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "Acquisition.h"
+#include "Check.h"
+#include "EventQueue.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>;
+
+int main()
+{
+  // zwei Threads: jedes Element kommt genau einmal und in Reihenfolge an
+  {
+    StaticEventQueue<uint32_t, 16> queue;
+    constexpr uint32_t ITEMS{4000000};
+
+    std::thread producer([&queue]() {
+      for (uint32_t n = 0; n < ITEMS; n++)
+      {
+        // volle Warteschlange: erneut versuchen, der Verbraucher holt auf
+        while (!queue.push(n))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+    uint32_t expected = 0;
+    uint32_t wrong = 0;
+    uint32_t value;
+
+    while (expected < ITEMS)
+    {
+      if (!queue.pop(value))
+      {
+        // leer: auf Rechnern mit einem Kern dem Erzeuger Zeit lassen
+        std::this_thread::yield();
+        continue;
+      }
+
+      wrong += (value != expected) ? 1 : 0;
+      expected = value + 1;
+    }
+    producer.join();
+
+    printf("%u Elemente, %u Versuche bei voller Warteschlange\n", ITEMS, queue.dropped());
+    CHECK_EQUAL(wrong, 0);
+    CHECK_EQUAL(expected, ITEMS);
+    CHECK(queue.empty());
+    CHECK(!queue.pop(value));
+  }
+
+  // schrittweise: lückenlose Nummern, Zeitstempel im Abstand der Periode, auch unverändert
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+
+    dev.setPipelined(false);
+    dev.bus().attach(device);
+    CHECK(dev.begin() == State::CONNECTED);
+
+    Acquisition<SimNunchuk, 64> acquisition{dev, 10};
+    for (uint8_t i = 0; i < 40; i++)
+    {
+      if (i % 10 == 0)
+      {
+        device.setInput(Joystick::X_NULL + i, Joystick::Y_NULL, 512, 512, 512, false, false);
+      }
+      CHECK(acquisition.step() == State::CONNECTED);
+      delay(10);
+    }
+    CHECK_EQUAL(acquisition.queue().size(), 40);
+
+    Sample sample;
+    Sample previous;
+    uint8_t count = 0;
+    uint8_t gaps = 0;
+    uint8_t jitter = 0;
+    unsigned long interval = 0;
+
+    while (acquisition.pop(sample))
+    {
+      if (count > 0)
+      {
+        gaps += (sample.sequence != previous.sequence + 1) ? 1 : 0;
+        // Periode plus Buszeit, die in jedem Zyklus gleich ist
+        interval = (count == 1) ? sample.time - previous.time : interval;
+        jitter += (sample.time - previous.time != interval) ? 1 : 0;
+      }
+      previous = sample;
+      count++;
+    }
+    CHECK_EQUAL(count, 40);
+    CHECK_EQUAL(gaps, 0);
+    CHECK_EQUAL(jitter, 0);
+    CHECK(interval >= 10000 && interval < 11000);
+    CHECK_EQUAL(previous.sequence, 39);
+    CHECK_EQUAL(previous.frame.decodeJoystickX(Joystick::X_NULL), 30);
+  }
+
+  // eigener Thread: lückenlose Nummern, Anzahl passend zur Periode
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+
+    dev.setPipelined(false);
+    dev.bus().attach(device);
+    CHECK(dev.begin() == State::CONNECTED);
+
+    Acquisition<SimNunchuk> acquisition{dev, 5};
+    CHECK(acquisition.start());
+    CHECK(acquisition.running());
+    CHECK(!acquisition.start());
+
+    Sample sample;
+    uint16_t count = 0;
+    uint16_t gaps = 0;
+    const auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+
+    while (std::chrono::steady_clock::now() < end)
+    {
+      while (acquisition.pop(sample))
+      {
+        gaps += (sample.sequence != count) ? 1 : 0;
+        count++;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    acquisition.stop();
+    CHECK(!acquisition.running());
+
+    while (acquisition.pop(sample))
+    {
+      gaps += (sample.sequence != count) ? 1 : 0;
+      count++;
+    }
+
+    // 100 Perioden, großzügige Grenzen für ausgelastete Testrechner
+    printf("%u Datensätze in 500 ms bei 5 ms Periode\n", count);
+    CHECK_EQUAL(gaps, 0);
+    CHECK_EQUAL(acquisition.queue().dropped(), 0);
+    CHECK(count >= 50);
+    CHECK(count <= 105);
+  }
+
+  return check::result("Acquisition");
+}
@@ -0,0 +1,166 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   AutoCenter.cpp
+ *
+ * @brief  Host-Test der Nachführung der Joystickmitte: nachgeführt wird nur in Ruhe, nie über
+ *         maxDrift hinaus und nicht, solange ein Button gedrückt ist; über den vollständigen
+ *         Lesepfad folgen die Mittenwerte des Geräts dem Schätzer.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/AutoCenter.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o autocenter && ./autocenter
+ */
+
+#include <Arduino.h>
+
+#include "AutoCenter.h"
+#include "Check.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using CenteringNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer,
+  AutoCenterSupport>;
+
+/**
+ * @brief Übergibt dem Schätzer count Datensätze und zählt die gemeldeten Änderungen
+ */
+uint16_t feed(AutoCenter &estimator, const uint16_t count, const uint8_t x, const uint8_t y,
+  const bool pressed = false)
+{
+  uint16_t changes = 0;
+
+  for (uint16_t i = 0; i < count; i++)
+  {
+    changes += estimator.update(x, y, pressed) ? 1 : 0;
+  }
+  return changes;
+}
+
+int main()
+{
+  // Ruhe neben der Mitte: erst nach SETTLE_SAMPLES, dann höchstens MAX_STEP je Datensatz
+  {
+    AutoCenter estimator;
+    estimator.reset(0x80, 0x80);
+
+    CHECK_EQUAL(feed(estimator, AutoCenter::SETTLE_SAMPLES - 1, 0x84, 0x7E), 0);
+    CHECK(!estimator.atRest());
+    CHECK_EQUAL(feed(estimator, 1, 0x84, 0x7E), 0);
+    CHECK(estimator.atRest());
+    CHECK_EQUAL(estimator.centerX(), 0x80);
+
+    // 4 Zählschritte zu 1/32 benötigen mindestens 128 Datensätze
+    feed(estimator, 100, 0x84, 0x7E);
+    CHECK(estimator.atRest());
+    CHECK(estimator.centerX() > 0x80 && estimator.centerX() < 0x84);
+
+    CHECK(feed(estimator, 200, 0x84, 0x7E) > 0);
+    CHECK_EQUAL(estimator.centerX(), 0x84);
+    CHECK_EQUAL(estimator.centerY(), 0x7E);
+    CHECK_EQUAL(feed(estimator, 100, 0x84, 0x7E), 0);
+  }
+
+  // Bewegung nahe der Mitte: hohe Streuung gilt nicht als Ruhe
+  {
+    AutoCenter estimator;
+    estimator.reset(0x80, 0x80);
+
+    for (uint16_t i = 0; i < 500; i++)
+    {
+      estimator.update((i % 2 == 0) ? 0x78 : 0x8A, 0x80, false);
+      CHECK(!estimator.atRest());
+    }
+    CHECK_EQUAL(estimator.centerX(), 0x80);
+  }
+
+  // außerhalb von restRange: ausgelenkter Joystick verschiebt die Mitte nicht
+  {
+    AutoCenter estimator{12, 24};
+    estimator.reset(0x80, 0x80);
+
+    CHECK_EQUAL(feed(estimator, 500, 0x80 + 13, 0x80), 0);
+    CHECK(!estimator.atRest());
+    CHECK_EQUAL(estimator.centerX(), 0x80);
+  }
+
+  // maxDrift: die Mitte folgt der Ruhelage nur bis zum Startwert +- maxDrift
+  {
+    AutoCenter estimator{30, 8};
+    estimator.reset(0x80, 0x80);
+
+    feed(estimator, 2000, 0x80 + 20, 0x80 - 20);
+    CHECK(estimator.atRest());
+    CHECK_EQUAL(estimator.centerX(), 0x80 + 8);
+    CHECK_EQUAL(estimator.centerY(), 0x80 - 8);
+
+    // reset() legt einen neuen Startwert fest, von dem aus wieder begrenzt wird
+    estimator.reset(0x88, 0x78);
+    feed(estimator, 2000, 0x80 + 20, 0x80 - 20);
+    CHECK_EQUAL(estimator.centerX(), 0x88 + 8);
+    CHECK_EQUAL(estimator.centerY(), 0x78 - 8);
+  }
+
+  // Button gedrückt: keine Nachführung, nach dem Loslassen erst wieder nach SETTLE_SAMPLES
+  {
+    AutoCenter estimator;
+    estimator.reset(0x80, 0x80);
+
+    feed(estimator, 50, 0x80, 0x80);
+    CHECK(estimator.atRest());
+
+    CHECK_EQUAL(feed(estimator, 500, 0x84, 0x80, true), 0);
+    CHECK(!estimator.atRest());
+    CHECK_EQUAL(estimator.centerX(), 0x80);
+
+    feed(estimator, AutoCenter::SETTLE_SAMPLES - 1, 0x84, 0x80);
+    CHECK(!estimator.atRest());
+    CHECK_EQUAL(estimator.centerX(), 0x80);
+
+    feed(estimator, 300, 0x84, 0x80);
+    CHECK_EQUAL(estimator.centerX(), 0x84);
+  }
+
+  // vollständiger Lesepfad: die Mittenwerte des Geräts folgen dem Schätzer
+  {
+    SimulatedNunchuk device;
+    CenteringNunchuk dev{0UL, 0UL};
+    AutoCenter estimator;
+
+    dev.setPipelined(false);
+    dev.setDeadzone(0);
+    dev.bus().attach(device);
+    CHECK(dev.begin() == State::CONNECTED);
+    dev.setAutoCenter(estimator);
+
+    const uint8_t centerX = dev.joystickCenterX();
+    const uint8_t centerY = dev.joystickCenterY();
+
+    device.setInput(centerX + 3, centerY - 2, 512, 512, 512, false, false);
+    for (uint16_t i = 0; i < 400; i++)
+    {
+      CHECK(dev.read() == State::CONNECTED);
+    }
+    CHECK_EQUAL(dev.joystickCenterX(), centerX + 3);
+    CHECK_EQUAL(dev.joystickCenterY(), centerY - 2);
+    CHECK_EQUAL(dev.decodeJoystickX(), 0);
+    CHECK_EQUAL(dev.decodeJoystickY(), 0);
+
+    // mit gedrücktem Button Z bleibt die Mitte stehen
+    device.setInput(centerX + 6, centerY - 2, 512, 512, 512, false, true);
+    for (uint16_t i = 0; i < 400; i++)
+    {
+      dev.read();
+    }
+    CHECK_EQUAL(dev.joystickCenterX(), centerX + 3);
+    CHECK_EQUAL(dev.decodeJoystickX(), 3);
+  }
+
+  return check::result("AutoCenter");
+}
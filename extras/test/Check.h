@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Check.h
+ *
+ * @brief  Minimale Prüfmakros der Host-Tests in extras/test. Jede fehlgeschlagene Prüfung wird
+ *         mit Datei und Zeile ausgegeben, result() liefert den Rückgabewert von main().
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <stdio.h>
+
+namespace check
+{
+  // Anzahl der Prüfungen und der fehlgeschlagenen Prüfungen
+  inline unsigned long total{0};
+  inline unsigned long failed{0};
+
+  inline void report(const bool passed, const char *expression, const char *file, const int line)
+  {
+    total++;
+    if (!passed)
+    {
+      failed++;
+      printf("%s:%d: Prüfung fehlgeschlagen: %s\n", file, line, expression);
+    }
+  }
+
+  inline void reportEqual(const long actual, const long expected, const char *expression,
+    const char *file, const int line)
+  {
+    total++;
+    if (actual != expected)
+    {
+      failed++;
+      printf("%s:%d: Prüfung fehlgeschlagen: %s ist %ld, erwartet %ld\n", file, line, expression,
+        actual, expected);
+    }
+  }
+
+  /**
+   * @brief Gibt die Zusammenfassung aus
+   *
+   * @return int 0 falls alle Prüfungen bestanden, sonst 1
+   */
+  inline int result(const char *name)
+  {
+    printf("%s: %lu Prüfungen, %lu fehlgeschlagen\n", name, total, failed);
+    return (failed == 0) ? 0 : 1;
+  }
+}
+
+#define CHECK(expression) check::report((expression), #expression, __FILE__, __LINE__)
+#define CHECK_EQUAL(actual, expected) \
+  check::reportEqual(static_cast<long>(actual), static_cast<long>(expected), #actual, __FILE__, __LINE__)
+
+#endif // !CHECK_H
@@ -0,0 +1,80 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   ClockContext.cpp
+ *
+ * @brief  Host-Test der Zeitbasis: ein zweiter Thread (wie Acquisition) tastet die Uhr ab und
+ *         rechnet Schlafzeit ein, ohne den abgetasteten Zeitpunkt des Hauptprogramms zu
+ *         verändern; timeUntilNextEvent() rechnet ab dem aktuellen Zeitpunkt.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/ClockContext.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o clockcontext -pthread && ./clockcontext
+ */
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Check.h"
+#include "Clock.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, CycleTimer>;
+
+int main()
+{
+  // Abtastzeitpunkt je Thread, die eingerechnete Schlafzeit gilt für alle
+  {
+    std::atomic<bool> started{false};
+
+    Clock::tick();
+    const unsigned long sampled = Clock::now();
+    const unsigned long before = Clock::current();
+
+    std::thread other([&started]() {
+      for (uint16_t i = 0; i < 1000; i++)
+      {
+        Clock::advance(10);
+        Clock::tick();
+      }
+      started = true;
+    });
+    other.join();
+
+    CHECK(started);
+    CHECK_EQUAL(Clock::now(), sampled);
+    CHECK_EQUAL(Clock::current() - before, 10000);
+    Clock::tick();
+    CHECK_EQUAL(Clock::now() - sampled, 10000);
+  }
+
+  // timeUntilNextEvent() ab dem aktuellen Zeitpunkt, nicht ab dem letzten Abtasten
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 20UL};
+
+    dev.bus().attach(device);
+    CHECK(dev.begin() == State::CONNECTED);
+    dev.read();
+
+    const unsigned long full = dev.timeUntilNextEvent();
+    delay(15);
+    const unsigned long later = dev.timeUntilNextEvent();
+    printf("Nächstes Ereignis: %lu µs nach read(), %lu µs nach weiteren 15 ms\n", full, later);
+    CHECK(full <= 20000);
+    CHECK_EQUAL(full - later, 15000);
+    delay(10);
+    CHECK_EQUAL(dev.timeUntilNextEvent(), 0);
+  }
+
+  return check::result("ClockContext");
+}
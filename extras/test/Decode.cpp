@@ -0,0 +1,99 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Decode.cpp
+ *
+ * @brief  Host-Test der Dekodierung: alle 10-Bit-Beschleunigungswerte und Joystickstellungen
+ *         eines SimulatedNunchuk über den Bus lesen und mit den Eingaben vergleichen.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Decode.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o decode && ./decode
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>;
+
+int main()
+{
+  SimulatedNunchuk device;
+  SimNunchuk dev{0UL, 0UL};
+
+  dev.bus().attach(device);
+  // jeder Aufruf von read() liest die zuletzt gesetzten Eingaben
+  dev.setPipelined(false);
+  CHECK_EQUAL(dev.begin(), State::CONNECTED);
+
+  // Frame ohne Bus: Mitte und Extremwerte
+  CHECK_EQUAL(Frame::neutral(0x80, 0x80).decodeAccelerationX(), 0);
+  CHECK_EQUAL(Frame::neutral(0x80, 0x80).decodeAccelerationY(), 0);
+  CHECK_EQUAL(Frame::neutral(0x80, 0x80).decodeAccelerationZ(), 0);
+
+  unsigned long mismatches = 0;
+  for (uint16_t value = 0; value < 1024; value++)
+  {
+    // drei verschiedene Werte je Datensatz, damit vertauschte Bits auffallen
+    const uint16_t x = value;
+    const uint16_t y = 1023 - value;
+    const uint16_t z = (value * 7) & 0x3FF;
+    const uint8_t joystick = static_cast<uint8_t>(value);
+
+    device.setInput(joystick, static_cast<uint8_t>(~joystick), x, y, z, value & 0x01, value & 0x02);
+    CHECK_EQUAL(dev.read(), State::CONNECTED);
+
+    const Frame frame = dev.snapshot();
+    const bool match = frame.decodeAccelerationX() == static_cast<int16_t>(x) - Acceleration::X_NULL
+      && frame.decodeAccelerationY() == static_cast<int16_t>(y) - Acceleration::Y_NULL
+      && frame.decodeAccelerationZ() == static_cast<int16_t>(z) - Acceleration::Z_NULL
+      && frame.decodeJoystickX(0) == joystick
+      && frame.decodeJoystickY(0) == static_cast<uint8_t>(~joystick)
+      && frame.decodeButtonC() == static_cast<bool>(value & 0x01)
+      && frame.decodeButtonZ() == static_cast<bool>(value & 0x02);
+
+    if (!match && mismatches++ < 5)
+    {
+      printf("Wert %u: X %d, Y %d, Z %d\n", value, frame.decodeAccelerationX(),
+        frame.decodeAccelerationY(), frame.decodeAccelerationZ());
+    }
+  }
+  CHECK_EQUAL(mismatches, 0);
+
+  // Ränder des Wertebereichs einzeln
+  device.setInput(0x80, 0x80, 0, 512, 1023, false, false);
+  dev.read();
+  CHECK_EQUAL(dev.decodeAccelerationX(), -512);
+  CHECK_EQUAL(dev.decodeAccelerationY(), 0);
+  CHECK_EQUAL(dev.decodeAccelerationZ(), 511);
+
+  device.setInput(0x80, 0x80, 513, 300, 1, false, false);
+  dev.read();
+  CHECK_EQUAL(dev.decodeAccelerationX(), 1);
+  CHECK_EQUAL(dev.decodeAccelerationY(), -212);
+  CHECK_EQUAL(dev.decodeAccelerationZ(), -511);
+  CHECK(!dev.isDuplicate());
+
+  // unveränderter Datensatz: gültig, aber als Wiederholung gekennzeichnet
+  const uint32_t duplicates = dev.duplicateFrames();
+  CHECK_EQUAL(dev.read(), State::CONNECTED);
+  CHECK(dev.isDuplicate());
+  CHECK_EQUAL(dev.duplicateFrames(), duplicates + 1);
+  CHECK_EQUAL(dev.decodeAccelerationX(), 1);
+
+  device.setInput(0x80, 0x80, 514, 300, 1, false, false);
+  CHECK_EQUAL(dev.read(), State::CONNECTED);
+  CHECK(!dev.isDuplicate());
+  CHECK_EQUAL(dev.decodeAccelerationX(), 2);
+
+  return check::result("Decode");
+}
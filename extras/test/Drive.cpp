@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Drive.cpp
+ *
+ * @brief  Host-Test von DifferentialDrive mit Lenkverstärkungen über 1,0: Stellwerte im
+ *         PWM-Bereich, Drehrichtung entsprechend der Mischung und Begrenzung der Verstärkung.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Drive.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o drive && ./drive
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "DifferentialDrive.h"
+
+using namespace communication;
+
+int main()
+{
+  // Vollausschlag vorwärts und rechts: links Vollgas, rechts langsam rückwärts
+  {
+    DifferentialDrive drive;
+
+    drive.setTurnGain(384);
+    const MotorCommand command = drive.update(127, 127);
+    CHECK_EQUAL(command.left, 255);
+    CHECK_EQUAL(command.right, -50);
+
+    drive.setTurnGain(512);
+    drive.update(127, 127);
+    CHECK_EQUAL(drive.command().left, 255);
+    CHECK_EQUAL(drive.command().right, -84);
+  }
+
+  // alle Joystickstellungen und Verstärkungen: Betrag höchstens pwmMax, Vorzeichen der Mischung
+  for (uint16_t gain = 0; gain <= DifferentialDrive::MAX_TURN_GAIN; gain += 64)
+  {
+    DifferentialDrive drive;
+    uint32_t violations = 0;
+
+    drive.setTurnGain(gain);
+    for (int16_t x = -127; x <= 127; x++)
+    {
+      for (int16_t y = -127; y <= 127; y++)
+      {
+        const MotorCommand command = drive.update(x, y);
+        const int32_t turn = static_cast<int32_t>(x) * gain / DifferentialDrive::UNITY_GAIN;
+
+        if (command.leftDuty() > 255 || command.rightDuty() > 255
+          || (y + turn > 0 && command.left < 0) || (y + turn < 0 && command.left > 0)
+          || (y - turn > 0 && command.right < 0) || (y - turn < 0 && command.right > 0))
+        {
+          violations++;
+        }
+      }
+    }
+    CHECK_EQUAL(violations, 0);
+  }
+
+  // Verstärkung über MAX_TURN_GAIN wird begrenzt
+  {
+    DifferentialDrive limited;
+    DifferentialDrive maximum;
+
+    limited.setTurnGain(0xFFFF);
+    maximum.setTurnGain(DifferentialDrive::MAX_TURN_GAIN);
+    CHECK_EQUAL(limited.update(40, 100).left, maximum.update(40, 100).left);
+    CHECK_EQUAL(limited.command().right, maximum.command().right);
+  }
+
+  return check::result("Drive");
+}
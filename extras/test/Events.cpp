@@ -0,0 +1,229 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Events.cpp
+ *
+ * @brief  Host-Test der Ereigniszustellung: Delegaten mit Kontext und auf Methoden, Überlauf und
+ *         Umlauf der Ereigniswarteschlange sowie das Abarbeiten der Ereignisse mehrerer Buttons
+ *         mit Button::drain().
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Events.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o events && ./events
+ */
+
+#include <Arduino.h>
+
+#include "Button.h"
+#include "Check.h"
+#include "Clock.h"
+#include "Delegate.h"
+#include "EventQueue.h"
+
+using namespace communication;
+
+/**
+ * @brief Zählt die zugestellten Ereignisse eines Buttons
+ */
+struct Recorder
+{
+  uint8_t pressed{0};
+  uint8_t released{0};
+  ButtonEvent last{};
+
+  void record(const ButtonEvent &event)
+  {
+    last = event;
+    (event.type == ButtonEvent::Type::PRESSED) ? pressed++ : released++;
+  }
+};
+
+int add(void *context, int value)
+{
+  return *static_cast<int *>(context) + value;
+}
+
+struct Accumulator
+{
+  int sum{0};
+
+  int add(int value)
+  {
+    sum += value;
+    return sum;
+  }
+};
+
+/**
+ * @brief Hält den Button über die Entprellzeit im angegebenen Zustand
+ */
+void hold(FrameButton &button, const bool pressed, const unsigned long ms)
+{
+  button.update(pressed);
+  delay(ms);
+  Clock::tick();
+  button.update(pressed);
+}
+
+int main()
+{
+  // Delegat auf Funktion mit Kontext
+  {
+    Delegate<int(int)> empty;
+    CHECK(!empty);
+
+    int base = 40;
+    Delegate<int(int)> function{&add, &base};
+    CHECK(static_cast<bool>(function));
+    CHECK_EQUAL(function(2), 42);
+    CHECK(function.context() == &base);
+
+    // der Kontext wird nicht kopiert
+    base = 10;
+    CHECK_EQUAL(function(2), 12);
+  }
+
+  // Delegat auf Methode
+  {
+    Accumulator accumulator;
+    const auto method = Delegate<int(int)>::fromMethod<Accumulator, &Accumulator::add>(accumulator);
+
+    CHECK(method.context() == &accumulator);
+    CHECK_EQUAL(method(3), 3);
+    CHECK_EQUAL(method(4), 7);
+    CHECK_EQUAL(accumulator.sum, 7);
+  }
+
+  // Überlauf: überzählige Ereignisse werden verworfen und gezählt, die übrigen bleiben erhalten
+  {
+    StaticEventQueue<uint8_t, 4> queue;
+    uint8_t value;
+
+    CHECK(queue.empty());
+    CHECK(!queue.pop(value));
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+      CHECK(queue.push(i));
+    }
+    CHECK_EQUAL(queue.size(), 4);
+    CHECK(!queue.push(4));
+    CHECK(!queue.push(5));
+    CHECK_EQUAL(queue.dropped(), 2);
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(value, i);
+    }
+    CHECK(queue.empty());
+    CHECK(!queue.pop(value));
+
+    // nach dem Leeren ist wieder Platz, der Zähler bleibt
+    CHECK(queue.push(6));
+    CHECK_EQUAL(queue.dropped(), 2);
+  }
+
+  // Umlauf: die Indizes laufen viele Male über das Speicherende, Reihenfolge und Größe stimmen
+  {
+    StaticEventQueue<uint16_t, 5> queue;
+    uint16_t next = 0;
+    uint16_t expected = 0;
+    uint16_t value;
+    uint16_t wrong = 0;
+
+    for (uint16_t round = 0; round < 1000; round++)
+    {
+      // abwechselnd 3 und 2 anhängen, je 2 entnehmen, bis die Warteschlange voll ist
+      const uint8_t count = (round % 2 == 0) ? 3 : 2;
+      for (uint8_t i = 0; i < count; i++)
+      {
+        if (queue.push(next))
+        {
+          next++;
+        }
+      }
+
+      for (uint8_t i = 0; i < 2 && queue.pop(value); i++)
+      {
+        wrong += (value != expected++) ? 1 : 0;
+      }
+      CHECK(queue.size() <= 5);
+    }
+
+    while (queue.pop(value))
+    {
+      wrong += (value != expected++) ? 1 : 0;
+    }
+
+    CHECK_EQUAL(wrong, 0);
+    CHECK_EQUAL(expected, next);
+    CHECK_EQUAL(next + queue.dropped(), 2500);
+  }
+
+  // Buttons an einer Warteschlange: Zustellung erst mit drain(), an den auslösenden Button
+  {
+    StaticEventQueue<ButtonEvent, 8> queue;
+    FrameButton c{30, 1};
+    FrameButton z{30, 2};
+    Recorder recorderC;
+    Recorder recorderZ;
+
+    c.onPressed(ButtonDelegate::fromMethod<Recorder, &Recorder::record>(recorderC));
+    c.onReleased(ButtonDelegate::fromMethod<Recorder, &Recorder::record>(recorderC));
+    z.onPressed(ButtonDelegate::fromMethod<Recorder, &Recorder::record>(recorderZ));
+    z.attach(queue, 7);
+    c.attach(queue, 7);
+
+    Clock::tick();
+    hold(c, true, 31);
+    const unsigned long pressedAt = Clock::now();
+    hold(z, true, 31);
+    hold(c, false, 31);
+
+    // Ereignisse liegen vor, es wurde noch nichts zugestellt
+    CHECK_EQUAL(queue.size(), 3);
+    CHECK_EQUAL(recorderC.pressed, 0);
+    CHECK_EQUAL(recorderZ.pressed, 0);
+
+    CHECK_EQUAL(Button::drain(queue), 3);
+    CHECK(queue.empty());
+    CHECK_EQUAL(recorderC.pressed, 1);
+    CHECK_EQUAL(recorderC.released, 1);
+    CHECK_EQUAL(recorderZ.pressed, 1);
+    CHECK_EQUAL(recorderZ.released, 0);
+
+    // Zeitstempel des Drückens, nicht des Abarbeitens
+    CHECK_EQUAL(recorderZ.last.device, 7);
+    CHECK_EQUAL(recorderZ.last.button, 2);
+    CHECK(recorderZ.last.source == &z);
+    CHECK(recorderZ.last.timestamp > pressedAt);
+    CHECK_EQUAL(recorderC.last.type, ButtonEvent::Type::RELEASED);
+    CHECK_EQUAL(Button::drain(queue), 0);
+
+    // getrennt: Zustellung wieder direkt beim Entprellen
+    c.detach();
+    hold(c, true, 31);
+    CHECK_EQUAL(recorderC.pressed, 2);
+    CHECK(queue.empty());
+
+    // voll: weitere Ereignisse werden verworfen und gezählt
+    c.attach(queue, 7);
+    for (uint8_t i = 0; i < 5; i++)
+    {
+      hold(c, false, 31);
+      hold(c, true, 31);
+    }
+    CHECK_EQUAL(queue.size(), 8);
+    CHECK_EQUAL(queue.dropped(), 2);
+    CHECK_EQUAL(Button::drain(queue), 8);
+    CHECK_EQUAL(recorderC.released, 1 + 4);
+    CHECK_EQUAL(recorderC.pressed, 2 + 4);
+  }
+
+  return check::result("Events");
+}
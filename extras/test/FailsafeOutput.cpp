@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   FailsafeOutput.cpp
+ *
+ * @brief  Host-Test des Failsafe: nach Fristablauf und nach Verbindungsverlust müssen alle
+ *         Ausgaben (Dekodierung, Filter, Buttons und Abonnenten) exakt neutral sein.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/FailsafeOutput.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o failsafe && ./failsafe
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Failsafe.h"
+#include "Nunchuk.h"
+#include "Publisher.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, ButtonDebounce, MovingAverageFilter<4>, NoCycleTimer,
+  PublisherSupport, FailsafeSupport>;
+
+/**
+ * @brief Merkt sich den letzten Datensatz, der bei ausgelöstem Failsafe zugestellt wurde
+ */
+struct Recorder
+{
+  Failsafe *failsafe;
+  Reading neutral;
+  uint32_t neutralCount;
+
+  void update(const Reading &reading)
+  {
+    if (failsafe->engaged())
+    {
+      neutral = reading;
+      neutralCount++;
+    }
+  }
+};
+
+/**
+ * @brief Prüft, dass alle Ausgaben neutral sind
+ */
+void checkNeutral(SimNunchuk &dev, const Recorder &recorder)
+{
+  CHECK_EQUAL(dev.decodeAccelerationX(), 0);
+  CHECK_EQUAL(dev.decodeAccelerationY(), 0);
+  CHECK_EQUAL(dev.decodeAccelerationZ(), 0);
+  CHECK_EQUAL(dev.filteredAccelerationX(), 0);
+  CHECK_EQUAL(dev.filteredAccelerationY(), 0);
+  CHECK_EQUAL(dev.filteredAccelerationZ(), 0);
+  CHECK_EQUAL(dev.decodeJoystickX(), 0);
+  CHECK_EQUAL(dev.decodeJoystickY(), 0);
+  CHECK(!dev.pressedC());
+  CHECK(!dev.pressedZ());
+
+  const Reading &reading = recorder.neutral;
+  CHECK_EQUAL(reading.fields, Field::ALL);
+  CHECK_EQUAL(reading.accelerationX, 0);
+  CHECK_EQUAL(reading.accelerationY, 0);
+  CHECK_EQUAL(reading.accelerationZ, 0);
+  CHECK_EQUAL(reading.filteredX, 0);
+  CHECK_EQUAL(reading.filteredY, 0);
+  CHECK_EQUAL(reading.filteredZ, 0);
+  CHECK_EQUAL(reading.joystickX, 0);
+  CHECK_EQUAL(reading.joystickY, 0);
+  CHECK(!reading.buttonC);
+  CHECK(!reading.buttonZ);
+}
+
+/**
+ * @brief Liest Datensätze mit ausgelenkten Werten und gedrückten Buttons, bis der Failsafe
+ *        freigegeben und die Entprellung durchlaufen ist
+ */
+void drive(SimNunchuk &dev, SimulatedNunchuk &device, const Failsafe &failsafe)
+{
+  for (uint8_t i = 0; i < 40; i++)
+  {
+    device.setInput(0xF0 - i, 0x10 + i, 900 - i, 100 + i, 700, true, true);
+    dev.read();
+    delay(2);
+  }
+
+  CHECK(!failsafe.engaged());
+  CHECK(dev.decodeAccelerationX() != 0);
+  CHECK(dev.filteredAccelerationY() != 0);
+  CHECK(dev.pressedC());
+}
+
+int main()
+{
+  SimulatedNunchuk device;
+  SimNunchuk dev{10UL, 0UL};
+  Failsafe failsafe{50, 10};
+  Publisher publisher;
+  Recorder recorder{&failsafe, {}, 0};
+
+  publisher.subscribe(4, Field::ALL, ReadingDelegate::fromMethod<Recorder, &Recorder::update>(recorder));
+  dev.setPublisher(publisher);
+  dev.bus().attach(device);
+  CHECK_EQUAL(dev.begin(), State::CONNECTED);
+  dev.setFailsafe(failsafe);
+
+  // bis zum ersten frischen Datensatz neutral
+  CHECK(failsafe.engaged());
+  checkNeutral(dev, recorder);
+
+  // Frist abgelaufen: read() wird weiter aufgerufen, das Gerät liefert aber nur ungültige
+  // Datensätze, die die Verbindung noch nicht beenden
+  drive(dev, device, failsafe);
+  recorder.neutralCount = 0;
+  device.setFaultRate(SimulatedFault::CORRUPT_FRAME, 1000000);
+  for (uint8_t i = 0; i < 6 && !failsafe.engaged(); i++)
+  {
+    delay(10);
+    dev.read();
+  }
+  device.clearFaults();
+  printf("Frist: ausgelöst %d, neutrale Datensätze %u\n", failsafe.engaged(), recorder.neutralCount);
+  CHECK(failsafe.engaged());
+  CHECK(recorder.neutralCount > 0);
+  checkNeutral(dev, recorder);
+
+  // Verbindungsverlust
+  drive(dev, device, failsafe);
+  recorder.neutralCount = 0;
+  dev.bus().detach();
+  dev.read();
+  CHECK(failsafe.engaged());
+  CHECK(recorder.neutralCount > 0);
+  checkNeutral(dev, recorder);
+
+  return check::result("FailsafeOutput");
+}
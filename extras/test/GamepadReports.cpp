@@ -0,0 +1,129 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   GamepadReports.cpp
+ *
+ * @brief  Host-Test des Gamepad über den vollständigen Lesepfad: Abbildung der Achsen auf den
+ *         Report und Anzahl der Reports in 10 s (Abfrage jede Millisekunde, Joystick 1 s
+ *         bewegt, Beschleunigung mit ±2 Einheiten Rauschen) mit und ohne Schwellen.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/GamepadReports.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o gamepad && ./gamepad
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Gamepad.h"
+#include "Nunchuk.h"
+#include "Publisher.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer, PublisherSupport>;
+
+/**
+ * @brief Zählt die angenommenen Reports und merkt sich den letzten
+ */
+struct Sink
+{
+  GamepadReport last;
+  uint32_t count;
+
+  bool send(const GamepadReport &report)
+  {
+    last = report;
+    count++;
+    return true;
+  }
+};
+
+/**
+ * @brief Simuliert 10 s und gibt die Anzahl der Reports zurück
+ *
+ * @param joystick Schwelle der Joystickachsen
+ * @param acceleration Schwelle der Beschleunigungsachsen
+ */
+uint32_t simulate(const uint8_t joystick, const uint8_t acceleration)
+{
+  SimulatedNunchuk device;
+  SimNunchuk dev{0UL, 0UL};
+  Publisher publisher;
+  Gamepad gamepad;
+  Sink sink{{}, 0};
+  uint32_t state = 1;
+
+  gamepad.setSink(ReportSink::fromMethod<Sink, &Sink::send>(sink));
+  gamepad.setThresholds(joystick, acceleration);
+  publisher.subscribe(1, gamepad.fields(), ReadingDelegate::fromMethod<Gamepad, &Gamepad::update>(gamepad));
+  dev.setPublisher(publisher);
+  dev.bus().attach(device);
+  dev.begin();
+
+  for (uint16_t ms = 0; ms < 10000; ms++)
+  {
+    // Joystick in der zweiten Sekunde einmal nach rechts und zurück
+    uint8_t x = Joystick::X_NULL;
+    if (ms >= 1000 && ms < 2000)
+    {
+      const uint16_t phase = ms - 1000;
+      x = Joystick::X_NULL + ((phase < 500) ? phase : 1000 - phase) / 4;
+    }
+
+    // Rauschen ±2 Einheiten je Achse um eine leichte Neigung
+    const auto jitter = [&state]() {
+      state = state * 1664525UL + 1013904223UL;
+      return static_cast<int16_t>((state >> 16) % 5) - 2;
+    };
+    device.setInput(x, Joystick::Y_NULL, 560 + jitter(), 500 + jitter(), 768 + jitter(), false, false);
+
+    dev.read();
+    gamepad.poll();
+    delay(1);
+  }
+
+  return sink.count;
+}
+
+int main()
+{
+  // Abbildung: Joystick auf X/Y (Y invertiert), Beschleunigung / 4 auf Rx/Ry/Rz
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+    Publisher publisher;
+    Gamepad gamepad;
+    Sink sink{{}, 0};
+
+    gamepad.setSink(ReportSink::fromMethod<Sink, &Sink::send>(sink));
+    publisher.subscribe(1, gamepad.fields(), ReadingDelegate::fromMethod<Gamepad, &Gamepad::update>(gamepad));
+    dev.setPublisher(publisher);
+    dev.setPipelined(false);
+    dev.bus().attach(device);
+    dev.begin();
+
+    device.setInput(Joystick::X_NULL + 40, Joystick::Y_NULL + 20, 512 + 200, 512 - 100, 1023, true, false);
+    dev.read();
+
+    CHECK_EQUAL(sink.last.x, 40);
+    CHECK_EQUAL(sink.last.y, -20);
+    CHECK_EQUAL(sink.last.rx, 50);
+    CHECK_EQUAL(sink.last.ry, -25);
+    CHECK_EQUAL(sink.last.rz, 127);
+    CHECK_EQUAL(sink.last.buttons, 0x01);
+  }
+
+  const uint32_t every = simulate(1, 1);
+  const uint32_t thresholds = simulate(1, 4);
+  printf("Reports in 10 s: %u bei jeder Änderung, %u mit Schwellen (Joystick 1, Beschleunigung 4)\n",
+    every, thresholds);
+  CHECK(thresholds * 4 < every);
+
+  return check::result("GamepadReports");
+}
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Gestures.cpp
+ *
+ * @brief  Host-Test der Gestenerkennung: Klick, Doppelklick, langer Druck, C+Z und ein Klick,
+ *         auf den der andere Button folgt, jeweils mit Zeitpunkt der Meldung. Am Nunchuk
+ *         bestimmt nach dem Ersetzen der Erkennung nur noch die neue timeUntilNextEvent().
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Gestures.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o gestures && ./gestures
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Clock.h"
+#include "EventQueue.h"
+#include "Gesture.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using GestureNunchuk = NunchukT<SimulatedBus, NoLevelShifter, ButtonDebounce, NoFilter, CycleTimer,
+  GestureSupport>;
+
+using Type = GestureEvent::Type;
+
+/**
+ * @brief Übergibt die Gedrücktzustände jede Millisekunde, wie ein Aufruf je Schleifendurchlauf
+ */
+void hold(GestureRecognizer &recognizer, const bool c, const bool z, const unsigned long ms)
+{
+  for (unsigned long i = 0; i < ms; i++)
+  {
+    Clock::tick();
+    recognizer.update(c, z);
+    delay(1);
+  }
+}
+
+/**
+ * @brief Prüft das nächste Ereignis der Warteschlange
+ */
+void expect(StaticEventQueue<GestureEvent, 8> &queue, const Type type, const uint8_t button,
+  const unsigned long earliest, const unsigned long latest)
+{
+  GestureEvent event{};
+
+  CHECK(queue.pop(event));
+  CHECK_EQUAL(event.type, type);
+  CHECK_EQUAL(event.button, button);
+  CHECK(event.timestamp >= earliest);
+  CHECK(event.timestamp <= latest);
+}
+
+int main()
+{
+  GestureRecognizer recognizer{600, 250};
+  StaticEventQueue<GestureEvent, 8> queue;
+  recognizer.attach(queue, 3);
+
+  // Klick: erst nach Ablauf des Doppelklickfensters gemeldet
+  {
+    hold(recognizer, true, false, 50);
+    const unsigned long released = micros();
+    hold(recognizer, false, false, 200);
+    CHECK(queue.empty());
+
+    hold(recognizer, false, false, 100);
+    expect(queue, Type::CLICK, 0, released + 250000, released + 252000);
+    CHECK(queue.empty());
+  }
+
+  // Doppelklick: beim zweiten Loslassen, ohne zusätzlichen Klick
+  {
+    hold(recognizer, false, true, 50);
+    hold(recognizer, false, false, 100);
+    hold(recognizer, false, true, 50);
+    const unsigned long released = micros();
+    hold(recognizer, false, false, 400);
+
+    expect(queue, Type::DOUBLE_CLICK, 1, released, released + 1000);
+    CHECK(queue.empty());
+  }
+
+  // langer Druck: nach der Haltezeit, noch während des Drückens; Loslassen meldet nichts
+  {
+    const unsigned long pressed = micros();
+    hold(recognizer, true, false, 550);
+    CHECK(queue.empty());
+    hold(recognizer, true, false, 250);
+    hold(recognizer, false, false, 400);
+
+    expect(queue, Type::LONG_PRESS, 0, pressed + 600000, pressed + 602000);
+    CHECK(queue.empty());
+  }
+
+  // C+Z: beim Drücken des zweiten Buttons, danach nichts bis beide losgelassen sind
+  {
+    hold(recognizer, false, true, 30);
+    const unsigned long chord = micros();
+    hold(recognizer, true, true, 800);
+    hold(recognizer, true, false, 100);
+    hold(recognizer, false, false, 400);
+
+    expect(queue, Type::CHORD, 0, chord, chord + 1000);
+    CHECK(queue.empty());
+  }
+
+  // Klick auf C, dann Z im Doppelklickfenster: der Klick wird sofort gemeldet, Z zählt neu
+  {
+    hold(recognizer, true, false, 50);
+    hold(recognizer, false, false, 100);
+    const unsigned long other = micros();
+    hold(recognizer, false, true, 50);
+    const unsigned long released = micros();
+    hold(recognizer, false, false, 400);
+
+    expect(queue, Type::CLICK, 0, other, other + 1000);
+    expect(queue, Type::CLICK, 1, released + 250000, released + 252000);
+    CHECK(queue.empty());
+  }
+
+  // Gerätekennung und Zurücksetzen: eine begonnene Geste wird verworfen
+  {
+    GestureEvent event{};
+
+    hold(recognizer, true, false, 500);
+    recognizer.reset();
+    hold(recognizer, true, false, 500);
+    CHECK(queue.empty());
+    hold(recognizer, true, false, 200);
+    CHECK(queue.pop(event));
+    CHECK_EQUAL(event.device, 3);
+    CHECK_EQUAL(event.type, Type::LONG_PRESS);
+    hold(recognizer, false, false, 10);
+  }
+
+  // Nunchuk: nach dem Ersetzen bestimmt nur noch der Zeitgeber der neuen Erkennung
+  {
+    SimulatedNunchuk device;
+    GestureNunchuk dev{20UL, 2000UL};
+    GestureRecognizer first;
+    GestureRecognizer second;
+
+    dev.bus().attach(device);
+    dev.setGestures(first);
+    CHECK(dev.begin() == State::CONNECTED);
+    dev.read();
+
+    first.update(true, false);
+    CHECK(dev.timeUntilNextEvent() <= 600000);
+
+    dev.setGestures(second);
+    dev.read();
+    Clock::tick();
+    CHECK(dev.timeUntilNextEvent() > 600000);
+
+    second.update(true, false);
+    CHECK(dev.timeUntilNextEvent() <= 600000);
+  }
+
+  return check::result("Gestures");
+}
@@ -0,0 +1,73 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   GroupRate.cpp
+ *
+ * @brief  Host-Test der Abtastrate von NunchukGroup: zwei Geräte mit 20 ms Zykluszeit, je 2 s
+ *         mit ruhendem und bewegtem Joystick. Die Abtastrate zählt jede erfolgreiche
+ *         Transaktion, die Änderungsrate nur geänderte Datensätze.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/GroupRate.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o grouprate && ./grouprate
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "NunchukGroup.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, CycleTimer>;
+
+// Zykluszeit je Gerät in ms
+constexpr unsigned long CYCLE_MS{20};
+
+int main()
+{
+  SimulatedNunchuk deviceA;
+  SimulatedNunchuk deviceB;
+  SimNunchuk a{0UL, CYCLE_MS};
+  SimNunchuk b{0UL, CYCLE_MS};
+  NunchukGroup<2, SimNunchuk> group;
+
+  a.bus().attach(deviceA);
+  b.bus().attach(deviceB);
+  group.add(a);
+  group.add(b);
+  CHECK_EQUAL(group.begin(), 2);
+
+  // Joystick ruht: jede Transaktion liefert einen unveränderten Datensatz
+  for (unsigned long ms = 0; ms < 2000; ms++)
+  {
+    group.read();
+    delay(1);
+  }
+  printf("Joystick ruht: %u Datensätze/s, %u geändert/s\n",
+    group.samplesPerSecond(), group.changesPerSecond());
+  CHECK(group.samplesPerSecond() >= 2 * 1000 * 9 / (10 * CYCLE_MS));
+  CHECK(group.changesPerSecond() <= 2);
+
+  // Joystick bewegt: jeder Datensatz ist geändert
+  for (unsigned long ms = 0; ms < 2000; ms++)
+  {
+    const uint8_t x = Joystick::X_NULL + ((ms / 5) % 40);
+    deviceA.setInput(x, Joystick::Y_NULL, 512, 512, 512, false, false);
+    deviceB.setInput(Joystick::X_NULL, x, 512, 512, 512, false, false);
+    group.read();
+    delay(1);
+  }
+  printf("Joystick bewegt: %u Datensätze/s, %u geändert/s\n",
+    group.samplesPerSecond(), group.changesPerSecond());
+  CHECK(group.samplesPerSecond() >= 2 * 1000 * 9 / (10 * CYCLE_MS));
+  CHECK(group.changesPerSecond() * 10 >= group.samplesPerSecond() * 9);
+
+  return check::result("GroupRate");
+}
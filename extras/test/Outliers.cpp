@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Outliers.cpp
+ *
+ * @brief  Host-Test der Filter auf Basis von MovingMedian über den vollständigen Lesepfad: ein
+ *         SimulatedNunchuk liefert Beschleunigungswerte mit Rauschen der beiden niederwertigen
+ *         Bits und alle 97 Datensätze einen Ausreißer auf 1023. Ausreißer müssen verworfen,
+ *         Rauschen darf nicht als Ausreißer gewertet werden.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Outliers.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o outliers && ./outliers
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+// Anzahl der Datensätze
+constexpr const uint16_t FRAMES{10000};
+
+// Abstand der Ausreißer in Datensätzen
+constexpr const uint16_t SPIKE_INTERVAL{97};
+
+// Beschleunigungswert ohne Ausreißer (10 Bit), die beiden niederwertigen Bits rauschen
+constexpr const uint16_t LEVEL{600};
+
+/**
+ * @brief Anzahl der verworfenen Werte, nur HampelFilter zählt sie
+ */
+template<class Filter>
+uint32_t rejectedBy(const Filter &)
+{
+  return 0;
+}
+
+template<size_t Width, uint8_t Threshold>
+uint32_t rejectedBy(const HampelFilter<Width, Threshold> &filter)
+{
+  return filter.rejected();
+}
+
+/**
+ * @brief Ermittelt die größte Abweichung der Filterausgabe vom ungestörten Wertebereich
+ *
+ * @tparam Filter Filter-Policy
+ * @param rejected Anzahl verworfener Werte, 0 falls der Filter sie nicht zählt
+ */
+template<class Filter>
+int16_t run(const char *name, uint32_t &rejected)
+{
+  using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, Filter, NoCycleTimer>;
+
+  SimulatedNunchuk device;
+  SimNunchuk dev{0UL, 0UL};
+  int16_t worst = 0;
+  uint16_t noisy = 0;
+
+  dev.bus().attach(device);
+  dev.setPipelined(false);
+  device.setNoise(true);
+  CHECK_EQUAL(dev.begin(), State::CONNECTED);
+
+  for (uint16_t frame = 0; frame < FRAMES; frame++)
+  {
+    const bool spike = (frame % SPIKE_INTERVAL) == SPIKE_INTERVAL - 1;
+    device.setInput(0x80, 0x80, spike ? 1023 : LEVEL, LEVEL, LEVEL, false, false);
+    dev.read();
+
+    // das Rauschen muss beim Filter ankommen, d. h. die Dekodierung liefert alle 10 Bit
+    noisy += (dev.decodeAccelerationY() != LEVEL - Acceleration::Y_NULL) ? 1 : 0;
+
+    // ungestörte Werte liegen in [LEVEL; LEVEL + 3]
+    if (frame >= SPIKE_INTERVAL)
+    {
+      const int16_t value = dev.filteredAccelerationX() + Acceleration::X_NULL;
+      const int16_t deviation = (value < LEVEL) ? LEVEL - value : ((value > LEVEL + 3) ? value - LEVEL - 3 : 0);
+      worst = (deviation > worst) ? deviation : worst;
+    }
+  }
+
+  rejected = rejectedBy(dev.filter());
+
+  printf("%-18s größte Abweichung %d LSB, verworfen %u, verrauschte Datensätze %u\n", name, worst,
+    rejected, noisy);
+  CHECK(noisy > FRAMES / 2);
+  return worst;
+}
+
+int main()
+{
+  uint32_t rejected;
+  CHECK_EQUAL(run<MedianFilter<5>>("MedianFilter<5>", rejected), 0);
+  CHECK_EQUAL(run<MedianFilter<9>>("MedianFilter<9>", rejected), 0);
+
+  // je Ausreißer genau ein verworfener Wert, das Rauschen bleibt unterhalb der Schwelle
+  const uint32_t spikes = FRAMES / SPIKE_INTERVAL;
+  CHECK_EQUAL(run<HampelFilter<5>>("HampelFilter<5>", rejected), 0);
+  CHECK_EQUAL(rejected, spikes);
+  CHECK_EQUAL(run<HampelFilter<9>>("HampelFilter<9>", rejected), 0);
+  CHECK_EQUAL(rejected, spikes);
+
+  // zum Vergleich: der gleitende Mittelwert verteilt den Ausreißer über das Fenster
+  CHECK(run<MovingAverageFilter<8>>("MovingAverage<8>", rejected) > 0);
+
+  return check::result("Outliers");
+}
@@ -0,0 +1,104 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Oversampling.cpp
+ *
+ * @brief  Host-Test des DecimationFilter über den vollständigen Lesepfad: ein SimulatedNunchuk
+ *         liefert Werte zwischen zwei 10-Bit-Stufen mit 1 LSB gaußschem Rauschen, die
+ *         12-Bit-Ausgabe muss die Zwischenwerte auflösen.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Oversampling.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o oversampling && ./oversampling
+ */
+
+#include <Arduino.h>
+
+#include <math.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using Filter = DecimationFilter<16>;
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, Filter, NoCycleTimer>;
+
+// Ausgabewerte je untersuchtem Wert
+constexpr const uint16_t OUTPUTS{256};
+
+/**
+ * @brief Normalverteilte Zufallszahl (Box-Muller) mit reproduzierbarem Startwert
+ */
+double gaussian()
+{
+  static uint32_t state{12345};
+  const auto uniform = []() {
+    state = state * 1664525UL + 1013904223UL;
+    return ((state >> 8) + 0.5) / 16777216.0;
+  };
+
+  return sqrt(-2.0 * log(uniform())) * cos(2.0 * M_PI * uniform());
+}
+
+int main()
+{
+  SimulatedNunchuk device;
+  SimNunchuk dev{0UL, 0UL};
+
+  dev.bus().attach(device);
+  dev.setPipelined(false);
+  CHECK_EQUAL(dev.begin(), State::CONNECTED);
+
+  const double truths[]{600.0, 600.25, 600.5, 600.75, 301.1, 731.6};
+  double sumSquaresRaw = 0.0;
+  double sumSquaresFiltered = 0.0;
+  unsigned long count = 0;
+
+  for (const double truth : truths)
+  {
+    double sum = 0.0;
+
+    for (uint16_t output = 0; output < OUTPUTS; output++)
+    {
+      const uint32_t before = dev.filter().outputs();
+
+      while (dev.filter().outputs() == before)
+      {
+        const long sample = lround(truth + gaussian());
+        const uint16_t value = static_cast<uint16_t>((sample < 0) ? 0 : ((sample > 1023) ? 1023 : sample));
+        device.setInput(0x80, 0x80, value, value, 512, false, false);
+        dev.read();
+
+        const double error = dev.decodeAccelerationX() - (truth - Acceleration::X_NULL);
+        sumSquaresRaw += error * error;
+      }
+
+      // Ausgabe mit 2^RESOLUTION_BITS skaliert, Fehler in 10-Bit-LSB
+      const double filtered = dev.filteredAccelerationX() / static_cast<double>(1 << Filter::RESOLUTION_BITS);
+      const double error = filtered - (truth - Acceleration::X_NULL);
+      sumSquaresFiltered += error * error;
+      sum += filtered;
+      count++;
+    }
+
+    const double mean = sum / OUTPUTS + Acceleration::X_NULL;
+    printf("Wert %.2f: Mittel der 12-Bit-Ausgabe %.3f\n", truth, mean);
+    // Auflösung der Viertelstufen
+    CHECK(fabs(mean - truth) < 0.1);
+  }
+
+  const double rmsRaw = sqrt(sumSquaresRaw / (count * 16.0));
+  const double rmsFiltered = sqrt(sumSquaresFiltered / count);
+  printf("Rauschen: einzelne Datensätze %.2f LSB RMS, DecimationFilter<16> %.2f LSB RMS\n",
+    rmsRaw, rmsFiltered);
+  CHECK(rmsFiltered < 0.35);
+  CHECK(rmsFiltered < rmsRaw / 3.0);
+
+  return check::result("Oversampling");
+}
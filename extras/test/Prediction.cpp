@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Prediction.cpp
+ *
+ * @brief  Host-Test von MotionPredictor über den vollständigen Lesepfad: Fehler gegenüber dem
+ *         zuletzt gelesenen Wert bei einer Sinusbewegung des Joysticks (1 Hz, 30 ms
+ *         Zykluszeit, Abfrage jede Millisekunde), Schätzung der Änderungsrate bei Zykluszeiten
+ *         über 65 ms, Begrenzung um den kalibrierten Mittenwert und Abfrage vor dem letzten
+ *         Datensatz.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Prediction.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o prediction && ./prediction
+ */
+
+#include <Arduino.h>
+#include <math.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "Predictor.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer>;
+
+/**
+ * @brief Joystickauslenkung der Sinusbewegung zum Zeitpunkt ms
+ */
+int16_t sine(const unsigned long ms)
+{
+  return static_cast<int16_t>(lround(100.0 * sin(2.0 * M_PI * ms / 1000.0)));
+}
+
+int main()
+{
+  // Sinusbewegung: mittlerer Fehler der Vorhersage gegenüber dem letzten Datensatz
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+    MotionPredictor predictor;
+
+    dev.setPipelined(false);
+    dev.setDeadzone(0);
+    dev.bus().attach(device);
+    dev.begin();
+
+    uint32_t predictedError = 0;
+    uint32_t heldError = 0;
+    int16_t held = 0;
+
+    for (unsigned long ms = 0; ms < 5000; ms++)
+    {
+      if (ms % 30 == 0)
+      {
+        device.setInput(Joystick::X_NULL + sine(ms), Joystick::Y_NULL, 512, 512, 512, false, false);
+        predictor.poll(dev);
+        held = dev.decodeJoystickX();
+      }
+
+      // erste Periode zum Einschwingen
+      if (ms >= 1000)
+      {
+        predictedError += abs(predictor.joystickX(micros()) - sine(ms));
+        heldError += abs(held - sine(ms));
+      }
+      delay(1);
+    }
+
+    printf("Mittlerer Fehler: %.1f Zählschritte mit Vorhersage, %.1f ohne\n",
+      predictedError / 4000.0, heldError / 4000.0);
+    CHECK(predictedError * 2 < heldError);
+  }
+
+  // Zykluszeit 100 ms: die Änderungsrate wird geschätzt, nicht bei jedem Datensatz verworfen
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+    MotionPredictor predictor;
+
+    predictor.setHorizon(150000);
+    dev.setPipelined(false);
+    dev.setDeadzone(0);
+    dev.bus().attach(device);
+    dev.begin();
+
+    for (uint8_t step = 0; step < 10; step++)
+    {
+      device.setInput(Joystick::X_NULL - 50 + step * 10, Joystick::Y_NULL, 512, 512, 512, false, false);
+      predictor.poll(dev);
+      delay(100);
+    }
+
+    // 100 ms nach dem letzten Datensatz (+40) sind etwa 10 Schritte mehr zu erwarten
+    const int16_t predicted = predictor.joystickX(micros());
+    printf("Vorhersage 100 ms nach dem letzten Datensatz: %d (zuletzt gelesen %d)\n",
+      predicted, dev.decodeJoystickX());
+    CHECK(predicted >= dev.decodeJoystickX() + 5);
+    CHECK(predicted <= dev.decodeJoystickX() + 15);
+  }
+
+  // kalibrierter Mittenwert 0x90: gültiger Bereich [-144;111] statt [-125;130]
+  {
+    SimulatedNunchuk device;
+    SimNunchuk dev{0UL, 0UL};
+    MotionPredictor predictor;
+
+    device.setCenter(0x90, Joystick::Y_NULL);
+    dev.setPipelined(false);
+    dev.setDeadzone(0);
+    dev.bus().attach(device);
+    dev.begin();
+    CHECK(dev.calibrate());
+    CHECK_EQUAL(dev.joystickCenterX(), 0x90);
+
+    for (uint8_t step = 0; step < 10; step++)
+    {
+      device.setInput(0, Joystick::Y_NULL, 512, 512, 512, false, false);
+      predictor.poll(dev);
+      delay(30);
+    }
+    CHECK_EQUAL(predictor.joystickX(micros()), -0x90);
+
+    // schneller Anstieg auf den Anschlag, die Extrapolation bleibt im Bereich
+    for (uint16_t x = 0; x <= 0xFF; x += 0x33)
+    {
+      device.setInput(x, Joystick::Y_NULL, 512, 512, 512, false, false);
+      predictor.poll(dev);
+      delay(30);
+    }
+    CHECK_EQUAL(predictor.joystickX(micros()), 0xFF - 0x90);
+  }
+
+  // Abfrage vor dem letzten Datensatz: keine Extrapolation, weder rückwärts noch bis zum Horizont
+  {
+    AlphaBetaPredictor predictor{-125, 130};
+
+    for (uint8_t step = 0; step < 10; step++)
+    {
+      predictor.update(step * 10, step * 10000UL);
+    }
+
+    const int16_t last = predictor.predict(90000);
+    CHECK(last >= 85 && last <= 95);
+    CHECK_EQUAL(predictor.predict(89999), last);
+    CHECK_EQUAL(predictor.predict(80000), last);
+    CHECK(predictor.predict(110000) > last);
+  }
+
+  return check::result("Prediction");
+}
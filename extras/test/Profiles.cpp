@@ -0,0 +1,101 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Profiles.cpp
+ *
+ * @brief  Host-Test der Geräteprofile: Übernahme von Mittenwerten und Totbereich beim erneuten
+ *         Start, Austausch gegen ein Gerät mit derselben ID und anderen Kalibrierungsdaten und
+ *         unveränderte Taktfrequenz des Konstruktors.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Profiles.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o profiles && ./profiles
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "Profile.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer, ProfileSupport>;
+
+/**
+ * @brief Startet ein neues Objekt mit dem angegebenen Gerät und Speicher, lenkt den Joystick
+ *        um 5 Einheiten aus und gibt den dekodierten Wert zurück
+ */
+int16_t start(SimNunchuk &dev, SimulatedNunchuk &device, ProfileStorage &storage)
+{
+  dev.setPipelined(false);
+  dev.setProfileStorage(storage);
+  dev.bus().attach(device);
+  dev.begin();
+
+  device.setInput(dev.joystickCenterX() + 5, Joystick::Y_NULL, 512, 512, 512, false, false);
+  dev.read();
+  return dev.decodeJoystickX();
+}
+
+int main()
+{
+  EmulatedEeprom<64> eeprom;
+  SimulatedNunchuk first;
+  SimulatedNunchuk second;
+
+  second.setCenter(0x90, 0x70);
+
+  // erster Start: kein Profil, Kalibrierung wird gespeichert, danach Totbereich anpassen
+  {
+    SimNunchuk dev{0UL, 0UL};
+    CHECK_EQUAL(start(dev, first, eeprom), 5);
+    CHECK(!dev.hasProfile());
+    dev.setDeadzone(8);
+    CHECK(dev.saveProfile());
+  }
+
+  // erneuter Start mit demselben Gerät: Totbereich aus dem Profil
+  {
+    SimNunchuk dev{0UL, 0UL};
+    CHECK_EQUAL(start(dev, first, eeprom), 0);
+    CHECK(dev.hasProfile());
+    CHECK_EQUAL(dev.joystickCenterX(), Joystick::X_NULL);
+  }
+
+  // anderes Gerät mit derselben ID: Profil gilt nicht, Mittenwerte aus der Kalibrierung
+  {
+    SimNunchuk dev{0UL, 0UL};
+    CHECK_EQUAL(start(dev, second, eeprom), 5);
+    CHECK(!dev.hasProfile());
+    CHECK_EQUAL(dev.joystickCenterX(), 0x90);
+    CHECK_EQUAL(dev.joystickCenterY(), 0x70);
+  }
+
+  // das Profil wurde für das neue Gerät gespeichert
+  {
+    SimNunchuk dev{0UL, 0UL};
+    start(dev, second, eeprom);
+    CHECK(dev.hasProfile());
+    CHECK_EQUAL(dev.joystickCenterX(), 0x90);
+  }
+
+  // ein Profil ändert die im Konstruktor gewählte Taktfrequenz nicht
+  {
+    SimNunchuk fast{0UL, 0UL, ClockMode::I2C_CLOCK_FAST_400_kHz};
+    start(fast, first, eeprom);
+    CHECK_EQUAL(fast.bus().clock(), 400000);
+
+    SimNunchuk standard{0UL, 0UL, ClockMode::I2C_CLOCK_STANDARD_100_kHz};
+    start(standard, first, eeprom);
+    CHECK(standard.hasProfile());
+    CHECK_EQUAL(standard.bus().clock(), 100000);
+  }
+
+  return check::result("Profiles");
+}
@@ -0,0 +1,213 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Publisher.cpp
+ *
+ * @brief  Host-Test der Verteilung an Abonnenten: Teiler je Abonnent, Vereinigung der Felder
+ *         der fälligen Abonnenten, einmalige Entnahme aus dem Briefkasten sowie die
+ *         Verteilung über den vollständigen Lesepfad.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Publisher.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o publisher && ./publisher
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "Publisher.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using PublishingNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer,
+  PublisherSupport>;
+
+/**
+ * @brief Merkt sich die zugestellten Datensätze eines Abonnenten
+ */
+struct Recorder
+{
+  uint16_t count{0};
+  uint8_t fields[32]{};
+  Reading last{};
+
+  void record(const Reading &reading)
+  {
+    fields[count++ % 32] = reading.fields;
+    last = reading;
+  }
+};
+
+/**
+ * @brief Verteilt count Datensätze wie der Nunchuk, ohne Gerät
+ */
+void publish(Publisher &publisher, const uint16_t count)
+{
+  for (uint16_t i = 0; i < count; i++)
+  {
+    if (publisher.prepare())
+    {
+      Reading reading{};
+      reading.fields = publisher.fields();
+      publisher.deliver(reading);
+    }
+  }
+}
+
+int main()
+{
+  // Teiler: erste Zustellung mit dem nächsten Datensatz, danach jeder divisor-te
+  {
+    Publisher publisher;
+    Recorder every;
+    Recorder third;
+    Recorder fifth;
+
+    CHECK_EQUAL(publisher.subscribe(0, Field::BUTTONS,
+      ReadingDelegate::fromMethod<Recorder, &Recorder::record>(every)), 0);
+    CHECK_EQUAL(publisher.subscribe(3, Field::BUTTONS,
+      ReadingDelegate::fromMethod<Recorder, &Recorder::record>(third)), 1);
+    CHECK_EQUAL(publisher.subscribe(5, Field::BUTTONS,
+      ReadingDelegate::fromMethod<Recorder, &Recorder::record>(fifth)), 2);
+
+    publish(publisher, 30);
+    CHECK_EQUAL(every.count, 30);
+    CHECK_EQUAL(third.count, 10);
+    CHECK_EQUAL(fifth.count, 6);
+    CHECK_EQUAL(publisher.deliveries(1), 10);
+    CHECK_EQUAL(publisher.published(), 30);
+    CHECK_EQUAL(publisher.decoded(), 30);
+
+    // Sequenznummern zählen nur die dekodierten Datensätze, Abstand beim Teiler 5
+    CHECK_EQUAL(every.last.sequence, 29);
+    CHECK_EQUAL(fifth.last.sequence, 25);
+
+    // ohne fälligen Abonnenten wird nicht dekodiert
+    publisher.unsubscribe(0);
+    publish(publisher, 30);
+    CHECK_EQUAL(every.count, 30);
+    CHECK_EQUAL(publisher.published(), 60);
+    // Datensätze 1, 4, 7, ... bzw. 1, 6, 11, ... von 30, davon 1, 16 doppelt
+    CHECK_EQUAL(publisher.decoded(), 30 + 10 + 6 - 2);
+
+    // volle Liste
+    Recorder spare;
+    for (uint8_t i = 0; i < Publisher::MAX_SUBSCRIBERS - 2; i++)
+    {
+      CHECK(publisher.subscribe(1, Field::ALL,
+        ReadingDelegate::fromMethod<Recorder, &Recorder::record>(spare)) != Publisher::INVALID_SUBSCRIBER);
+    }
+    CHECK_EQUAL(publisher.subscribe(1, Field::ALL,
+      ReadingDelegate::fromMethod<Recorder, &Recorder::record>(spare)), Publisher::INVALID_SUBSCRIBER);
+  }
+
+  // Felder: Vereinigung der in diesem Datensatz fälligen Abonnenten
+  {
+    Publisher publisher;
+    Recorder buttons;
+    Recorder acceleration;
+    Recorder filtered;
+
+    publisher.subscribe(1, Field::BUTTONS, ReadingDelegate::fromMethod<Recorder, &Recorder::record>(buttons));
+    publisher.subscribe(2, Field::ACCELERATION, ReadingDelegate::fromMethod<Recorder, &Recorder::record>(acceleration));
+    publisher.subscribe(3, Field::FILTERED | Field::BUTTONS,
+      ReadingDelegate::fromMethod<Recorder, &Recorder::record>(filtered));
+
+    publish(publisher, 7);
+
+    constexpr uint8_t ALL_DUE = Field::BUTTONS | Field::ACCELERATION | Field::FILTERED;
+    const uint8_t expected[7] = {ALL_DUE, Field::BUTTONS, Field::BUTTONS | Field::ACCELERATION,
+      Field::BUTTONS | Field::FILTERED, Field::BUTTONS | Field::ACCELERATION, Field::BUTTONS, ALL_DUE};
+    uint8_t wrong = 0;
+
+    for (uint8_t i = 0; i < 7; i++)
+    {
+      wrong += (buttons.fields[i] != expected[i]) ? 1 : 0;
+    }
+    CHECK_EQUAL(wrong, 0);
+    CHECK_EQUAL(acceleration.count, 4);
+    CHECK_EQUAL(filtered.count, 3);
+
+    // prepareAll(): alle Abonnenten, ohne zu zählen
+    CHECK(publisher.prepareAll());
+    CHECK_EQUAL(publisher.fields(), ALL_DUE);
+    Reading reading{};
+    publisher.deliver(reading);
+    CHECK_EQUAL(acceleration.count, 5);
+    CHECK_EQUAL(publisher.published(), 7);
+  }
+
+  // Briefkasten: jeder Datensatz wird höchstens einmal entnommen, nur der neueste
+  {
+    Publisher publisher;
+    Mailbox mailbox;
+    Reading reading{};
+
+    CHECK(!mailbox.fetch(reading));
+    publisher.subscribe(1, Field::JOYSTICK, mailbox);
+
+    publish(publisher, 1);
+    CHECK(mailbox.fetch(reading));
+    CHECK_EQUAL(reading.sequence, 0);
+    CHECK_EQUAL(reading.fields, Field::JOYSTICK);
+    CHECK(!mailbox.fetch(reading));
+    CHECK(!mailbox.fetch(reading));
+
+    // ältere Datensätze werden überschrieben
+    publish(publisher, 3);
+    CHECK(mailbox.fetch(reading));
+    CHECK_EQUAL(reading.sequence, 3);
+    CHECK(!mailbox.fetch(reading));
+
+    publish(publisher, 1);
+    CHECK(mailbox.fetch(reading));
+    CHECK_EQUAL(reading.sequence, 4);
+  }
+
+  // vollständiger Lesepfad: nur geänderte Datensätze, nur die angeforderten Felder
+  {
+    SimulatedNunchuk device;
+    PublishingNunchuk dev{0UL, 0UL};
+    Publisher publisher;
+    Recorder joystick;
+    Mailbox mailbox;
+    Reading reading{};
+
+    dev.setPipelined(false);
+    dev.setDeadzone(0);
+    dev.bus().attach(device);
+    CHECK(dev.begin() == State::CONNECTED);
+    dev.setPublisher(publisher);
+    publisher.subscribe(1, Field::JOYSTICK, ReadingDelegate::fromMethod<Recorder, &Recorder::record>(joystick));
+    publisher.subscribe(2, Field::ACCELERATION, mailbox);
+
+    for (uint8_t i = 1; i <= 4; i++)
+    {
+      device.setInput(Joystick::X_NULL + i, Joystick::Y_NULL, 512 + i, 512, 512, false, false);
+      CHECK(dev.read() == State::CONNECTED);
+      // unveränderter Datensatz wird nicht verteilt
+      CHECK(dev.read() == State::CONNECTED);
+      CHECK(dev.isDuplicate());
+    }
+
+    CHECK_EQUAL(publisher.published(), 4);
+    CHECK_EQUAL(joystick.count, 4);
+    CHECK_EQUAL(joystick.last.fields, Field::JOYSTICK);
+    CHECK_EQUAL(joystick.last.joystickX, 4);
+    CHECK_EQUAL(joystick.last.accelerationX, 0);
+
+    // Datensätze 1 und 3, entnommen wird der dritte
+    CHECK(mailbox.fetch(reading));
+    CHECK_EQUAL(reading.fields, Field::ACCELERATION | Field::JOYSTICK);
+    CHECK_EQUAL(reading.accelerationX, 3);
+    CHECK(!mailbox.fetch(reading));
+  }
+
+  return check::result("Publisher");
+}
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   Scheduler.cpp
+ *
+ * @brief  Host-Test des BusScheduler: zwei simulierte Nunchuks teilen sich einen Bus, einer
+ *         wird abgezogen und wieder angesteckt.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/Scheduler.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o scheduler && ./scheduler
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, CycleTimer>;
+
+// Zykluszeit beider Geräte in ms
+constexpr const unsigned long CYCLE_MS{20};
+
+/**
+ * @brief Ruft read() beider Geräte jede Millisekunde auf und zählt die Transaktionen
+ */
+void run(SimNunchuk &a, SimNunchuk &b, const unsigned long ms, unsigned long &countA,
+  unsigned long &countB)
+{
+  countA = 0;
+  countB = 0;
+
+  for (unsigned long end = millis() + ms; static_cast<long>(millis() - end) < 0;)
+  {
+    // mit Rauschen liefert fast jede Transaktion einen neuen Datensatz
+    countA += (a.read() == State::CONNECTED) ? 1 : 0;
+    countB += (b.read() == State::CONNECTED) ? 1 : 0;
+
+    delay(1);
+  }
+}
+
+int main()
+{
+  SimulatedNunchuk deviceA;
+  SimulatedNunchuk deviceB;
+  SimNunchuk a{0UL, CYCLE_MS};
+  SimNunchuk b{0UL, CYCLE_MS};
+  BusScheduler scheduler{2};
+
+  deviceA.setNoise(true);
+  deviceB.setNoise(true);
+  a.bus().attach(deviceA);
+  b.bus().attach(deviceB);
+  CHECK(a.attach(scheduler));
+  CHECK(b.attach(scheduler));
+  CHECK_EQUAL(a.begin(), State::CONNECTED);
+  CHECK_EQUAL(b.begin(), State::CONNECTED);
+
+  unsigned long countA;
+  unsigned long countB;
+
+  // beide verbunden: je Gerät eine Transaktion je Zykluszeit
+  run(a, b, 2000, countA, countB);
+  printf("verbunden: A %lu, B %lu Transaktionen in 2 s\n", countA, countB);
+  CHECK(countA >= 2000 * 9 / (10 * CYCLE_MS));
+  CHECK(countB >= 2000 * 9 / (10 * CYCLE_MS));
+
+  // A abgezogen: B darf nicht verhungern
+  a.bus().detach();
+  run(a, b, 5000, countA, countB);
+  printf("A abgezogen: B %lu Transaktionen in 5 s\n", countB);
+  CHECK(!a.isConnected());
+  CHECK(countB >= 5000 * 9 / (10 * CYCLE_MS));
+
+  // A wieder angesteckt: beide erneut im Takt
+  deviceA.powerCycle();
+  a.bus().attach(deviceA);
+  run(a, b, 2000, countA, countB);
+  printf("A angesteckt: A %lu, B %lu Transaktionen in 2 s\n", countA, countB);
+  CHECK(a.isConnected());
+  // bis zu Control::RECONNECT_MAX_US Wartezeit bis zum nächsten Verbindungsaufbau
+  CHECK(countA >= (2000 - Control::RECONNECT_MAX_US / 1000) * 9 / (10 * CYCLE_MS));
+  CHECK(countB >= 2000 * 9 / (10 * CYCLE_MS));
+
+  return check::result("Scheduler");
+}
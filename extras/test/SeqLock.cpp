@@ -0,0 +1,142 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   SeqLock.cpp
+ *
+ * @brief  Host-Test der Sequenzsperre: ein Schreiber-Thread veröffentlicht fortlaufend, der
+ *         Leser darf nie eine zerrissene Kopie als konsistent erhalten. Der Zähler der
+ *         Wiederholungen und die Begrenzung auf MAX_RETRIES werden mit einem Schreiber geprüft,
+ *         der während des Kopierens veröffentlicht.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/SeqLock.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o seqlock -pthread && ./seqlock
+ */
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <thread>
+
+#include "Check.h"
+#include "SeqLock.h"
+
+using namespace communication;
+
+// groß genug, dass der Schreiber den Leser mitten in der Kopie unterbrechen kann
+struct Block
+{
+  uint32_t words[64];
+};
+
+/**
+ * @brief Element, dessen Kopie die Sperre erneut veröffentlichen lässt, solange Störungen
+ *        anstehen
+ */
+struct Interrupted
+{
+  uint32_t value;
+
+  static SeqLock<Interrupted> *lock;
+  static uint16_t pending;
+
+  Interrupted &operator=(const Interrupted &other)
+  {
+    value = other.value;
+    if (lock && pending > 0)
+    {
+      pending--;
+      lock->publish();
+    }
+    return *this;
+  }
+};
+
+SeqLock<Interrupted> *Interrupted::lock{nullptr};
+uint16_t Interrupted::pending{0};
+
+int main()
+{
+  // Schreiber-Thread: jede konsistente Kopie enthält nur Wörter derselben Veröffentlichung
+  {
+    SeqLock<Block> lock;
+    std::atomic<bool> done{false};
+    constexpr uint32_t WRITES{200000};
+
+    std::thread writer([&lock, &done]() {
+      for (uint32_t n = 1; n <= WRITES; n++)
+      {
+        Block &next = lock.back();
+        for (uint8_t i = 0; i < 64; i++)
+        {
+          next.words[i] = n;
+        }
+        lock.publish();
+      }
+      done = true;
+    });
+
+    uint32_t reads = 0;
+    uint32_t torn = 0;
+    uint32_t backwards = 0;
+    uint32_t previous = 0;
+    Block copy;
+
+    while (!done)
+    {
+      if (!lock.read(copy))
+      {
+        continue;
+      }
+
+      reads++;
+      for (uint8_t i = 1; i < 64; i++)
+      {
+        torn += (copy.words[i] != copy.words[0]) ? 1 : 0;
+      }
+      backwards += (copy.words[0] < previous) ? 1 : 0;
+      previous = copy.words[0];
+    }
+    writer.join();
+
+    printf("%u konsistente Kopien, %u Wiederholungen\n", reads, lock.retries());
+    CHECK(reads > 0);
+    CHECK_EQUAL(torn, 0);
+    CHECK_EQUAL(backwards, 0);
+    CHECK_EQUAL(lock.read().words[63], WRITES);
+  }
+
+  // Wiederholungen werden gezählt, danach ist die Kopie konsistent
+  {
+    SeqLock<Interrupted> lock;
+    Interrupted::lock = &lock;
+
+    // beide Puffer füllen, damit jede Veröffentlichung denselben Wert zeigt
+    lock.write(Interrupted{7});
+    lock.write(Interrupted{7});
+    Interrupted::pending = 3;
+
+    Interrupted copy{0};
+    CHECK(lock.read(copy));
+    CHECK_EQUAL(lock.retries(), 3);
+    CHECK_EQUAL(copy.value, 7);
+
+    // jede Kopie gestört: read(T&) meldet nach MAX_RETRIES Versuchen den Fehlschlag
+    Interrupted::pending = 1000;
+    CHECK(!lock.read(copy));
+    CHECK_EQUAL(lock.retries(), 3 + SeqLock<Interrupted>::MAX_RETRIES);
+
+    // read() kehrt ebenfalls zurück statt zu hängen
+    lock.read();
+    CHECK_EQUAL(lock.retries(), 3 + 2 * SeqLock<Interrupted>::MAX_RETRIES);
+
+    Interrupted::pending = 0;
+    Interrupted::lock = nullptr;
+  }
+
+  return check::result("SeqLock");
+}
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2026, ardu-nunchuk contributors
+ * SPDX-License-Identifier: LGPL-3.0-or-later
+ */
+
+/**
+ * @file   WarmStart.cpp
+ *
+ * @brief  Host-Test des Warmstarts nach einem Neustart des Controllers: mit Profilspeicher
+ *         wird der gemessene Mindestabstand übernommen statt erneut gemessen, begin() ist
+ *         damit deutlich kürzer als ein Kaltstart. Ein ruhendes Gerät ohne Rauschen behält
+ *         den Standardabstand, der weder als gemessen gilt noch gespeichert wird.
+ *
+ *         Übersetzen und Ausführen im Wurzelverzeichnis der Bibliothek:
+ *
+ *         g++ -std=c++17 -O2 -fpermissive -w -Iextras/host -I. extras/test/WarmStart.cpp \
+ *             extras/host/Arduino.cpp *.cpp -o warmstart && ./warmstart
+ */
+
+#include <Arduino.h>
+
+#include "Check.h"
+#include "Nunchuk.h"
+#include "Profile.h"
+#include "SimulatedBus.h"
+
+using namespace communication;
+
+using SimNunchuk = NunchukT<SimulatedBus, NoLevelShifter, NoDebounce, NoFilter, NoCycleTimer, ProfileSupport>;
+
+/**
+ * @brief Gibt die Dauer von begin() in µs zurück
+ */
+unsigned long timedBegin(SimNunchuk &dev)
+{
+  const unsigned long start = micros();
+  CHECK(dev.begin() == State::CONNECTED);
+  return micros() - start;
+}
+
+int main()
+{
+  EmulatedEeprom<64> eeprom;
+  SimulatedNunchuk device;
+
+  device.setNoise(true);
+  device.setConversionTime(120);
+
+  // Kaltstart: Initialisierung, Kalibrierung und Messung des Mindestabstands
+  SimNunchuk cold{0UL, 0UL};
+  cold.setProfileStorage(eeprom);
+  cold.bus().attach(device);
+  const unsigned long coldTime = timedBegin(cold);
+  const unsigned long gap = cold.conversionGap();
+
+  // Neustart des Controllers, das Gerät bleibt initialisiert
+  SimNunchuk warm{0UL, 0UL};
+  warm.setProfileStorage(eeprom);
+  warm.bus().attach(device);
+  const unsigned long warmTime = timedBegin(warm);
+
+  // Neustart ohne Profilspeicher: der Mindestabstand wird erneut gemessen
+  SimNunchuk unprofiled{0UL, 0UL};
+  unprofiled.bus().attach(device);
+  const unsigned long unprofiledTime = timedBegin(unprofiled);
+
+  printf("begin(): Kaltstart %lu µs, Warmstart mit Profil %lu µs, ohne Profil %lu µs, Mindestabstand %lu µs\n",
+    coldTime, warmTime, unprofiledTime, gap);
+
+  CHECK(warm.hasProfile());
+  CHECK_EQUAL(warm.conversionGap(), gap);
+  CHECK(warmTime * 4 < coldTime);
+  CHECK(warmTime * 4 < unprofiledTime);
+
+  // der übernommene Abstand liefert gültige Datensätze
+  uint16_t connected = 0;
+  for (uint16_t i = 0; i < 100; i++)
+  {
+    connected += (warm.read() == State::CONNECTED) ? 1 : 0;
+    delay(5);
+  }
+  CHECK(connected >= 90);
+
+  // ruhendes Gerät ohne Rauschen: veraltete Datensätze sind nicht erkennbar
+  {
+    EmulatedEeprom<64> stillEeprom;
+    SimulatedNunchuk still;
+    still.setConversionTime(120);
+
+    SimNunchuk dev{0UL, 0UL};
+    dev.setProfileStorage(stillEeprom);
+    dev.bus().attach(still);
+    CHECK(dev.begin() == State::CONNECTED);
+    CHECK_EQUAL(dev.conversionGap(), Control::DELAY_REGISTER_US);
+
+    // das Profil des neuen Geräts wird einmal abgelegt, ohne Mindestabstand
+    CHECK(!dev.hasProfile());
+    const uint16_t writes = stillEeprom.writes();
+    CHECK(writes > 0);
+
+    // erneute Messung und erneuter Verbindungsaufbau speichern nichts
+    CHECK_EQUAL(dev.tuneConversionGap(), Control::DELAY_REGISTER_US);
+    CHECK(dev.begin() == State::CONNECTED);
+    CHECK(dev.hasProfile());
+    CHECK_EQUAL(dev.conversionGap(), Control::DELAY_REGISTER_US);
+    CHECK_EQUAL(stillEeprom.writes(), writes);
+
+    // Warmstart: kein gespeicherter Abstand, der Standardwert bleibt
+    SimNunchuk restarted{0UL, 0UL};
+    restarted.setProfileStorage(stillEeprom);
+    restarted.bus().attach(still);
+    CHECK(restarted.begin() == State::CONNECTED);
+    CHECK_EQUAL(restarted.conversionGap(), Control::DELAY_REGISTER_US);
+    CHECK_EQUAL(stillEeprom.writes(), writes);
+  }
+
+  return check::result("WarmStart");
+}
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026, ardu-nunchuk contributors
+# SPDX-License-Identifier: LGPL-3.0-or-later
+
+"""Wandelt die Ausgabe von Trace::dump() in das Trace-Format von Chrome/Perfetto.
+
+Die Eingabe darf weitere Ausgaben der seriellen Schnittstelle sowie mehrere Ausgaben von
+Trace::dump() enthalten; doppelt enthaltene Einträge werden nur einmal übernommen. Die
+Zeitstempel werden über den Überlauf von micros() hinweg fortgeschrieben.
+
+Aufzeichnen und Anzeigen, z. B.:
+
+    cat /dev/ttyACM0 > trace.bin      (Sketch ruft Trace::dump(Serial) auf)
+    python3 extras/trace_to_chrome.py trace.bin -o trace.json
+
+trace.json in https://ui.perfetto.dev oder chrome://tracing öffnen.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = b"NTRC"
+HEADER = struct.Struct("<4sBBHI")
+RECORD = struct.Struct("<IIBB")
+VERSION = 1
+
+# Namen der Phasen, siehe TracePoint in Trace.h
+POINTS = {
+    0: "read",
+    1: "begin",
+    2: "enable",
+    3: "disable",
+    4: "select",
+    5: "probe",
+    6: "initialize",
+    7: "calibrate",
+    8: "measureConversionGap",
+    9: "writePointer",
+    10: "awaitConversion",
+    11: "requestFrom",
+    12: "receive",
+    13: "filter",
+    14: "debounce",
+    15: "gestures",
+    16: "distribute",
+    17: "print",
+}
+
+# erste Kennung für eigene Phasen der Anwendung
+USER = 64
+
+# Argumente, die als solche benannt ausgegeben werden
+ARGS = {
+    11: "bytes",
+}
+
+
+def parse(data):
+    """Liefert je Ausgabe von Trace::dump() die Anzahl überschriebener Einträge und die
+    Einträge als Tupel (start, duration, point, arg)."""
+    dumps = []
+    position = data.find(MAGIC)
+
+    while position >= 0 and position + HEADER.size <= len(data):
+        _, version, size, count, dropped = HEADER.unpack_from(data, position)
+        body = position + HEADER.size
+
+        if version != VERSION or size != RECORD.size or body + count * size > len(data):
+            # keine gültige Ausgabe, z. B. zufällig "NTRC" in anderen Daten oder abgeschnitten
+            position = data.find(MAGIC, position + 1)
+            continue
+
+        records = [RECORD.unpack_from(data, body + i * size) for i in range(count)]
+        dumps.append((dropped, records))
+        position = data.find(MAGIC, body + count * size)
+
+    return dumps
+
+
+def unwrap(dumps):
+    """Schreibt die 32-Bit-Zeitstempel fort und entfernt doppelte Einträge."""
+    events = []
+    seen = set()
+    offset = 0
+    last = None
+
+    for _, records in dumps:
+        for start, duration, point, arg in records:
+            key = (start, duration, point, arg)
+            if key in seen:
+                continue
+            seen.add(key)
+
+            # Einträge liegen in der Reihenfolge ihres Endes vor, ein Rücksprung um mehr als
+            # die halbe Überlaufperiode ist ein Überlauf von micros()
+            if last is not None and start < last and last - start > 0x80000000:
+                offset += 0x100000000
+            last = start
+
+            events.append((offset + start, duration, point, arg))
+
+    return events
+
+
+def name(point):
+    if point in POINTS:
+        return POINTS[point]
+    if point >= USER:
+        return "user%d" % (point - USER)
+    return "point%d" % point
+
+
+def convert(events, dropped):
+    trace = []
+    origin = min((start for start, _, _, _ in events), default=0)
+
+    for start, duration, point, arg in events:
+        trace.append({
+            "name": name(point),
+            "cat": "user" if point >= USER else "nunchuk",
+            "ph": "X",
+            "ts": start - origin,
+            "dur": duration,
+            "pid": 1,
+            "tid": 1,
+            "args": {ARGS.get(point, "arg"): arg},
+        })
+
+    trace.sort(key=lambda event: (event["ts"], -event["dur"]))
+
+    return {
+        "traceEvents": trace,
+        "displayTimeUnit": "ms",
+        "otherData": {"dropped": dropped, "origin_us": origin},
+    }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("input", help="Aufzeichnung der seriellen Schnittstelle, - für stdin")
+    parser.add_argument("-o", "--output", help="Ausgabedatei, ohne Angabe stdout")
+    options = parser.parse_args()
+
+    if options.input == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(options.input, "rb") as file:
+            data = file.read()
+
+    dumps = parse(data)
+    if not dumps:
+        sys.exit("keine Ausgabe von Trace::dump() gefunden")
+
+    events = unwrap(dumps)
+    # Zähler seit dem letzten Trace::clear(), die letzte Ausgabe enthält alle
+    dropped = dumps[-1][0]
+    result = json.dumps(convert(events, dropped), indent=1)
+
+    if options.output:
+        with open(options.output, "w") as file:
+            file.write(result)
+    else:
+        sys.stdout.write(result)
+
+    sys.stderr.write("%d Ausgaben, %d Einträge, %d überschrieben\n" % (len(dumps), len(events), dropped))
+
+
+if __name__ == "__main__":
+    main()